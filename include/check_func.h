@@ -50,16 +50,17 @@ struct dh_trace_stack {
 };
 
 extern LUSHAPI struct dh_trace_stack *dh_trace_root;
+extern LUSHAPI int dh_trace_frozen;  /* no tracing while compiled code runs on threads */
 
 LUSHAPI void print_dh_recent(int,FILE*);
 LUSHAPI void print_dh_trace_stack(void);
 
 #define TRACE_PUSH(s) \
  struct dh_trace_stack _trace; _trace.info = s; \
- _trace.next = dh_trace_root; dh_trace_root = &_trace; 
+ _trace.next = dh_trace_root; if (!dh_trace_frozen) dh_trace_root = &_trace; 
 
 #define TRACE_POP(s) \
-  dh_trace_root = _trace.next;
+  if (!dh_trace_frozen) dh_trace_root = _trace.next;
 
 
 /* Tracing is enabled when running code from SN.
@@ -268,6 +269,11 @@ LUSHAPI bool idx_emptyp(index_t *);
     Msize_or_check_2D((i0)->dim[2], (i0)->dim[3], i1); \
     Msize_or_check_2D((i0)->dim[0], (i0)->dim[1], i2);
 
+#define Mcheck_main_main_maout_dot22(i0, i1, i2) \
+    if ((i0)->dim[1] != (i1)->dim[0]) \
+        lush_error(rterr_bad_dimensions); \
+    Msize_or_check_2D((i0)->dim[0], (i1)->dim[1], i2);
+
 #define Mcheck_main_m0out(i1, i2) \
     Mcheck0(i2);
 
@@ -331,6 +337,8 @@ LUSHAPI void check_main_main_maout_dot21(index_t *i0,
                                          index_t *i1, index_t *i2);
 LUSHAPI void check_main_main_maout_dot42(index_t *i0, 
                                          index_t *i1, index_t *i2);
+LUSHAPI void check_main_main_maout_dot22(index_t *i0, 
+                                         index_t *i1, index_t *i2);
 LUSHAPI void check_m1in_m1in_m2out(index_t *i0, 
                                    index_t *i1, index_t *i2);
 LUSHAPI void check_m2in_m2in_m4out(index_t *i0, 
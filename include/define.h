@@ -72,6 +72,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <assert.h>
+#if HAVE_PTHREAD
+# include <pthread.h>
+#endif
 
 /* untyped pointer */
 typedef void* gptr;
@@ -259,6 +262,7 @@ typedef void* mptr;  /* for managed addresses */
 #define HASHTABLESIZE (int)1024	/* symbol hashtable size */
 #define STRING_BUFFER (int)4096	/* string operations buffer size */
 #define LINE_BUFFER   (int)1024	/* line buffer length */
+#define READ_BUFFER   (int)65536	/* stdio buffer size for files read */
 #define FILELEN       (int)1024	/* file names length */
 #define DZ_STACK_SIZE (int)1000 /* stack size for DZs */
 #define MINSTORAGE    (size_t)4 /* min number of elements allocated */
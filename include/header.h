@@ -132,6 +132,12 @@ LUSHAPI pid_t filteropenpty(const char *cmd, FILE **pfw, FILE **pfr);
 LUSHAPI FILE* unix_popen(const char *cmd, const char *mode);
 LUSHAPI int   unix_pclose(FILE *f);
 LUSHAPI int   unix_setenv(const char *name, const char *value);
+/* parallel work */
+LUSHAPI void  run_tiles(void (*f)(void *, ptrdiff_t, ptrdiff_t), void *arg,
+                        ptrdiff_t n, ptrdiff_t grain);
+# if HAVE_PTHREAD
+LUSHAPI int   start_worker(pthread_t *t, void *(*f)(void *), void *arg);
+# endif
 /* cygwin */
 # ifdef __CYGWIN32__
 LUSHAPI void cygwin_fmode_text(FILE *f);
@@ -183,13 +189,22 @@ extern LUSHAPI class_t *gptr_class;
 extern LUSHAPI class_t *mptr_class;
 extern LUSHAPI class_t *window_class;
 
+/* numbers are stored in the at itself when pointers have 64 bits */
+#if UINTPTR_MAX >= 0xffffffffffffffffULL
+# define IMMEDIATE_NUMBERS
+#endif
+
 struct at {
    union {
       class_t *cl;
       struct at *car;
    } head;
    union {
+#ifdef IMMEDIATE_NUMBERS
+      double d;
+#else
       double *d;
+#endif
       void   *p;
       const char *c;
       struct lush_symbol *s;
@@ -198,7 +213,11 @@ struct at {
 };
 
 #define Class(q)  classof(q)
+#ifdef IMMEDIATE_NUMBERS
+#define Number(q) ((q)->payload.d)
+#else
 #define Number(q) (*(q)->payload.d)
+#endif
 #define String(q) ((q)->payload.c)
 #define Symbol(q) ((q)->payload.s)
 #define Value(q)  (Symbol(q)->valueptr ? *Symbol(q)->valueptr : NIL)
@@ -570,6 +589,12 @@ typedef struct cfunction cfunction_t;
 struct lfunction {
    at *formal_args;
    at *body;
+   at **vars;         /* argument symbols and defaults, or NULL */
+   bool analyzed;     /* formal_args analyzed for fast calls */
+   short nreq;        /* number of required arguments */
+   short nopt;        /* number of optional arguments */
+   short rest;        /* 0: none, 1: dotted symbol, 2: &rest */
+   int ncalls;        /* calls since last hot-function-hook */
 };
 
 typedef struct lfunction lfunction_t;
@@ -906,6 +931,8 @@ LUSHAPI storage_t *new_storage(storage_type_t);
 LUSHAPI storage_t *new_storage_managed(storage_type_t, size_t, at*);
 LUSHAPI storage_t *new_storage_foreign(storage_type_t, size_t, void *, bool);
 LUSHAPI storage_t *new_storage_mmap(storage_type_t, FILE*, size_t, bool);
+LUSHAPI storage_t *new_storage_shared(storage_type_t, size_t);
+LUSHAPI void storage_share(storage_t *);
 LUSHAPI storage_t *new_storage_static(storage_type_t, size_t, const void *);
 
 /* storage properties */
@@ -1057,11 +1084,15 @@ LUSHAPI index_t *array_select(index_t*, int d, ptrdiff_t n);
 LUSHAPI index_t *array_take2(index_t*, index_t *ss);
 LUSHAPI index_t *array_take3(index_t*, int d, index_t *ss);
 LUSHAPI index_t *array_put(index_t*, index_t *ss, index_t *vals);
+LUSHAPI void     array_sort(index_t*, int d, index_t *p, bool down);
+enum reduce_op { RED_SUM, RED_MEAN, RED_VAR, RED_SUP, RED_INF };
+LUSHAPI index_t *array_reduce_along(index_t*, int d, enum reduce_op, index_t *r, index_t *p);
 LUSHAPI index_t *array_range(double, double, double);
 LUSHAPI index_t *array_rangeS(double, double, double);
 
 LUSHAPI void import_array(index_t*, FILE*, size_t);
 LUSHAPI void import_array_text(index_t*, FILE*);
+LUSHAPI void import_array_text_columns(index_t*, FILE*, const int*, int);
 LUSHAPI int  save_array_len (index_t*);
 LUSHAPI void save_array(index_t*, FILE*);
 LUSHAPI void export_array(index_t*, FILE*);
@@ -331,6 +331,50 @@
     return p3;                                          \
   }
 
+#define Xidx_2i2i2o(FUNC_NAME, CHECK_FUNC)                 \
+  DX(name2(Xidx_,FUNC_NAME))                               \
+  {                                                        \
+    at *p3;                                                \
+    index_t *ind1, *ind2, *ind3;                           \
+    if (arg_number==2) {                                   \
+      ind1 = AINDEX(1);                                    \
+      ind2 = AINDEX(2);                                    \
+      if(IND_NDIMS(ind1) != 2 || IND_NDIMS(ind2) != 2)     \
+        ERRBADARGS;                                        \
+      ind3 = make_array(IND_STTYPE(ind1),                  \
+                        SHAPE2D(IND_DIM(ind1, 0),          \
+                                IND_DIM(ind2, 1)), NIL);   \
+      p3 = ind3->backptr;                                  \
+    }  else {                                              \
+      ARG_NUMBER(3);                                       \
+      ind1 = AINDEX(1);                                    \
+      ind2 = AINDEX(2);                                    \
+      p3 = APOINTER(3);                                    \
+      ind3 = AINDEX(3);                                    \
+    }                                                      \
+    if(IND_NDIMS(ind1) != 2 || IND_NDIMS(ind2) != 2 ||     \
+       IND_NDIMS(ind3) != 2) ERRBADARGS;                   \
+    CHECK_FUNC(ind1, ind2, ind3);                          \
+    switch_type1(name2(Midx_,FUNC_NAME));                  \
+    return p3;                                             \
+  }
+
+/* accumulating variant: the output holds the initial sum, so it
+   cannot be allocated here */
+#define Xidx_2i2i2acc(FUNC_NAME, CHECK_FUNC)               \
+  DX(name2(Xidx_,FUNC_NAME))                               \
+  {                                                        \
+    ARG_NUMBER(3);                                         \
+    index_t *ind1 = AINDEX(1);                             \
+    index_t *ind2 = AINDEX(2);                             \
+    index_t *ind3 = AINDEX(3);                             \
+    if(IND_NDIMS(ind1) != 2 || IND_NDIMS(ind2) != 2 ||     \
+       IND_NDIMS(ind3) != 2) ERRBADARGS;                   \
+    CHECK_FUNC(ind1, ind2, ind3);                          \
+    switch_type1(name2(Midx_,FUNC_NAME));                  \
+    return APOINTER(3);                                    \
+  }
+
 #define Xidx_4i2i2o(FUNC_NAME, CHECK_FUNC)             \
   DX(name2(Xidx_,FUNC_NAME))                           \
   {                                                    \
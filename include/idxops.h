@@ -1221,6 +1221,65 @@
   } \
 }
 
+/* ========= matrix products ============ */
+
+/* The product of M2 (IxK) by M2 (KxJ) is blocked over K and J.
+ * When the rows of the second operand and of the result are
+ * contiguous, rows of the result are updated with unit stride 
+ * inner loops.
+ * Otherwise each result is a dot product along K.
+ * The result must not share storage with the operands. */
+
+#define MIDX_MATPROD_KBLOCK 128
+#define MIDX_MATPROD_JBLOCK 512
+
+#define Midx_m2timesm2acc(i1, i2, o1, Type1, Type2, Type3) \
+{ ptrdiff_t imax = (i1)->dim[0], kmax = (i1)->dim[1], jmax = (i2)->dim[1]; \
+  ptrdiff_t c1_m0 = (i1)->mod[0], c1_m1 = (i1)->mod[1]; \
+  ptrdiff_t c2_m0 = (i2)->mod[0], c2_m1 = (i2)->mod[1]; \
+  ptrdiff_t d1_m0 = (o1)->mod[0], d1_m1 = (o1)->mod[1]; \
+  Type1 *c1 = IDX_PTR((i1), Type1); \
+  Type2 *c2 = IDX_PTR((i2), Type2); \
+  Type3 *d1 = IDX_PTR((o1), Type3); \
+  if (c2_m1 == 1 && d1_m1 == 1) { \
+    for (ptrdiff_t k0=0; k0<kmax; k0+=MIDX_MATPROD_KBLOCK) { \
+      ptrdiff_t k1 = k0 + MIDX_MATPROD_KBLOCK; \
+      if (k1 > kmax) k1 = kmax; \
+      for (ptrdiff_t j0=0; j0<jmax; j0+=MIDX_MATPROD_JBLOCK) { \
+        ptrdiff_t j1 = j0 + MIDX_MATPROD_JBLOCK; \
+        if (j1 > jmax) j1 = jmax; \
+        for (ptrdiff_t i=0; i<imax; i++) { \
+          Type3 *d = d1 + i*d1_m0; \
+          for (ptrdiff_t k=k0; k<k1; k++) { \
+            Type1 f = c1[i*c1_m0 + k*c1_m1]; \
+            Type2 *c = c2 + k*c2_m0; \
+            for (ptrdiff_t j=j0; j<j1; j++) \
+              d[j] += f * c[j]; \
+          } \
+        } \
+      } \
+    } \
+  } else { \
+    for (ptrdiff_t i=0; i<imax; i++) \
+      for (ptrdiff_t j=0; j<jmax; j++) { \
+        Type1 *a = c1 + i*c1_m0; \
+        Type2 *b = c2 + j*c2_m1; \
+        Type3 f = 0; \
+        for (ptrdiff_t k=0; k<kmax; k++) \
+          f += a[k*c1_m1] * b[k*c2_m0]; \
+        d1[i*d1_m0 + j*d1_m1] += f; \
+      } \
+  } \
+}
+
+#define Midx_m2timesm2(i1, i2, o1, Type1, Type2, Type3) \
+{ Type3 *d1 = IDX_PTR((o1), Type3); \
+  for (size_t i=0; i<(o1)->dim[0]; i++) \
+    for (size_t j=0; j<(o1)->dim[1]; j++) \
+      d1[i*(o1)->mod[0] + j*(o1)->mod[1]] = 0; \
+  Midx_m2timesm2acc(i1, i2, o1, Type1, Type2, Type3); \
+}
+
 /* ========= partial dot products for convolutions and matrix products == */
 /*           with accumulation ============ */
 
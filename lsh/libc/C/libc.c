@@ -0,0 +1,863 @@
+/* WARNING: Automatically generated code.
+ * This code has been generated by the DH compiler.
+ */
+#ifdef HAVE_CONFIG_H
+# include "lushconf.h"
+#endif
+
+/*
+ * USER DEFINED HEADERS
+ */
+#include <stdlib.h>
+#include <string.h>
+/*
+ * LUSH HEADERS
+ */
+#include "header.h"
+#include "dh.h"
+#include "idxmac.h"
+#include "idxops.h"
+#include "check_func.h"
+#undef uchar
+/*
+ * USER DEFINED HEADERS
+ */
+static int endiantest = 1;
+#define little_endian_p (*(char*)&endiantest)
+
+
+
+/* ---------------------------------------- */
+
+
+/*
+ * FUNCTION little-endianp
+ */
+extern_c bool C_little_endianp()
+{
+TRACE_PUSH("C_little_endianp"); MM_ENTER;
+{
+bool L_Tmp0;
+L_Tmp0 = (bool)( little_endian_p);
+TRACE_POP("C_little_endianp");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION malloc
+ */
+extern_c gptr C_malloc(int L1_n)
+{
+TRACE_PUSH("C_malloc"); MM_ENTER;
+{
+gptr L_Tmp0;
+L_Tmp0 = (gptr)( malloc((L1_n)));
+TRACE_POP("C_malloc");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION free
+ */
+extern_c bool C_free(gptr L1_p)
+{
+TRACE_PUSH("C_free"); MM_ENTER;
+{
+ if ((L1_p)) free((L1_p));
+TRACE_POP("C_free");
+MM_EXIT; return 0;
+}
+}
+
+/*
+ * FUNCTION memcpy
+ */
+extern_c bool C_memcpy(gptr L1_dest,gptr L1_src,int L1_size)
+{
+TRACE_PUSH("C_memcpy"); MM_ENTER;
+{
+ memcpy((L1_dest),(L1_src),(L1_size));
+TRACE_POP("C_memcpy");
+MM_EXIT; return 0;
+}
+}
+
+/*
+ * FUNCTION peek-ubyte
+ */
+extern_c int C_peek_ubyte(unsigned char * L1_s)
+{
+TRACE_PUSH("C_peek_ubyte"); MM_ENTER;
+{
+int L_Tmp0;
+L_Tmp0 = (int)( *(unsigned char *)((L1_s)));
+TRACE_POP("C_peek_ubyte");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION poke-ubyte
+ */
+extern_c int C_poke_ubyte(unsigned char * L1_s,unsigned char L1_v)
+{
+TRACE_PUSH("C_poke_ubyte"); MM_ENTER;
+{
+int L_Tmp0;
+L_Tmp0 = (int)( *(unsigned char *)((L1_s)) = (unsigned char)(L1_v));
+TRACE_POP("C_poke_ubyte");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION sizeof-ubyte
+ */
+extern_c int C_sizeof_ubyte()
+{
+TRACE_PUSH("C_sizeof_ubyte"); MM_ENTER;
+{
+int L_Tmp0;
+L_Tmp0 = (int)( sizeof(unsigned char));
+TRACE_POP("C_sizeof_ubyte");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION peek-short
+ */
+extern_c int C_peek_short(short * L1_s)
+{
+TRACE_PUSH("C_peek_short"); MM_ENTER;
+{
+int L_Tmp0;
+L_Tmp0 = (int)( *(short *)((L1_s)));
+TRACE_POP("C_peek_short");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION poke-short
+ */
+extern_c int C_poke_short(short * L1_s,short L1_v)
+{
+TRACE_PUSH("C_poke_short"); MM_ENTER;
+{
+int L_Tmp0;
+L_Tmp0 = (int)( *(short *)((L1_s)) = (short)(L1_v));
+TRACE_POP("C_poke_short");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION sizeof-short
+ */
+extern_c int C_sizeof_short()
+{
+TRACE_PUSH("C_sizeof_short"); MM_ENTER;
+{
+int L_Tmp0;
+L_Tmp0 = (int)( sizeof(short));
+TRACE_POP("C_sizeof_short");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION peek-int
+ */
+extern_c int C_peek_int(int * L1_s)
+{
+TRACE_PUSH("C_peek_int"); MM_ENTER;
+{
+int L_Tmp0;
+L_Tmp0 = (int)( *(int *)((L1_s)));
+TRACE_POP("C_peek_int");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION poke-int
+ */
+extern_c int C_poke_int(int * L1_s,int L1_v)
+{
+TRACE_PUSH("C_poke_int"); MM_ENTER;
+{
+int L_Tmp0;
+L_Tmp0 = (int)( *(int *)((L1_s)) = (int)(L1_v));
+TRACE_POP("C_poke_int");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION sizeof-int
+ */
+extern_c int C_sizeof_int()
+{
+TRACE_PUSH("C_sizeof_int"); MM_ENTER;
+{
+int L_Tmp0;
+L_Tmp0 = (int)( sizeof(int));
+TRACE_POP("C_sizeof_int");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION peek-float
+ */
+extern_c float C_peek_float(float * L1_s)
+{
+TRACE_PUSH("C_peek_float"); MM_ENTER;
+{
+float L_Tmp0;
+L_Tmp0 = (float)( *(float *)((L1_s)));
+TRACE_POP("C_peek_float");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION poke-float
+ */
+extern_c float C_poke_float(float * L1_s,float L1_v)
+{
+TRACE_PUSH("C_poke_float"); MM_ENTER;
+{
+float L_Tmp0;
+L_Tmp0 = (float)( *(float *)((L1_s)) = (float)(L1_v));
+TRACE_POP("C_poke_float");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION sizeof-float
+ */
+extern_c int C_sizeof_float()
+{
+TRACE_PUSH("C_sizeof_float"); MM_ENTER;
+{
+int L_Tmp0;
+L_Tmp0 = (int)( sizeof(float));
+TRACE_POP("C_sizeof_float");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION peek-double
+ */
+extern_c double C_peek_double(double * L1_s)
+{
+TRACE_PUSH("C_peek_double"); MM_ENTER;
+{
+double L_Tmp0;
+L_Tmp0 = (double)( *(double *)((L1_s)));
+TRACE_POP("C_peek_double");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION poke-double
+ */
+extern_c double C_poke_double(double * L1_s,double L1_v)
+{
+TRACE_PUSH("C_poke_double"); MM_ENTER;
+{
+double L_Tmp0;
+L_Tmp0 = (double)( *(double *)((L1_s)) = (double)(L1_v));
+TRACE_POP("C_poke_double");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION sizeof-double
+ */
+extern_c int C_sizeof_double()
+{
+TRACE_PUSH("C_sizeof_double"); MM_ENTER;
+{
+int L_Tmp0;
+L_Tmp0 = (int)( sizeof(double));
+TRACE_POP("C_sizeof_double");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION peek-gptr
+ */
+extern_c gptr C_peek_gptr(gptr * L1_s)
+{
+TRACE_PUSH("C_peek_gptr"); MM_ENTER;
+{
+gptr L_Tmp0;
+L_Tmp0 = (gptr)( *(gptr *)((L1_s)));
+TRACE_POP("C_peek_gptr");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION poke-gptr
+ */
+extern_c gptr C_poke_gptr(gptr * L1_s,gptr L1_v)
+{
+TRACE_PUSH("C_poke_gptr"); MM_ENTER;
+{
+gptr L_Tmp0;
+L_Tmp0 = (gptr)( *(gptr *)((L1_s)) = (gptr)(L1_v));
+TRACE_POP("C_poke_gptr");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * FUNCTION sizeof-gptr
+ */
+extern_c int C_sizeof_gptr()
+{
+TRACE_PUSH("C_sizeof_gptr"); MM_ENTER;
+{
+int L_Tmp0;
+L_Tmp0 = (int)( sizeof(gptr));
+TRACE_POP("C_sizeof_gptr");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/* ---------------------------------------- */
+
+#ifndef NOLISP
+
+
+/*
+ * STUB little-endianp
+ */
+DH(X_little_endianp)
+{
+dharg ret;
+ret.dh_bool =  C_little_endianp();
+return ret;
+}
+
+/*
+ * DHDOC little-endianp
+ */
+DHDOC(K_little_endianp_Ra8b05737,X_little_endianp,"C_little_endianp",0,0) = {
+DH_FUNC(0),
+DH_RETURN,
+DH_BOOL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB malloc
+ */
+DH(X_malloc)
+{
+dharg ret;
+ret.dh_gptr =  C_malloc(a[1].dh_int);
+return ret;
+}
+
+/*
+ * DHDOC malloc
+ */
+DHDOC(K_malloc_R7b698833,X_malloc,"C_malloc",0,0) = {
+DH_FUNC(1),
+DH_INT,
+DH_RETURN,
+DH_GPTR(0),
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB free
+ */
+DH(X_free)
+{
+dharg ret;
+ret.dh_bool =  C_free(a[1].dh_gptr);
+return ret;
+}
+
+/*
+ * DHDOC free
+ */
+DHDOC(K_free_Rc7df00c0,X_free,"C_free",0,0) = {
+DH_FUNC(1),
+DH_GPTR(0),
+DH_RETURN,
+DH_NIL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB memcpy
+ */
+DH(X_memcpy)
+{
+dharg ret;
+ret.dh_bool =  C_memcpy(a[1].dh_gptr, a[2].dh_gptr, a[3].dh_int);
+return ret;
+}
+
+/*
+ * DHDOC memcpy
+ */
+DHDOC(K_memcpy_R94ba92aa,X_memcpy,"C_memcpy",0,0) = {
+DH_FUNC(3),
+DH_GPTR(0),
+DH_GPTR(0),
+DH_INT,
+DH_RETURN,
+DH_NIL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB peek-ubyte
+ */
+DH(X_peek_ubyte)
+{
+dharg ret;
+ret.dh_int =  C_peek_ubyte((unsigned char * )a[1].dh_gptr);
+return ret;
+}
+
+/*
+ * DHDOC peek-ubyte
+ */
+DHDOC(K_peek_ubyte_R6d6f2621,X_peek_ubyte,"C_peek_ubyte",0,0) = {
+DH_FUNC(1),
+DH_GPTR("unsigned char *"),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB poke-ubyte
+ */
+DH(X_poke_ubyte)
+{
+dharg ret;
+ret.dh_int =  C_poke_ubyte((unsigned char * )a[1].dh_gptr, a[2].dh_uchar);
+return ret;
+}
+
+/*
+ * DHDOC poke-ubyte
+ */
+DHDOC(K_poke_ubyte_Rd734da6f,X_poke_ubyte,"C_poke_ubyte",0,0) = {
+DH_FUNC(2),
+DH_GPTR("unsigned char *"),
+DH_UCHAR,
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB sizeof-ubyte
+ */
+DH(X_sizeof_ubyte)
+{
+dharg ret;
+ret.dh_int =  C_sizeof_ubyte();
+return ret;
+}
+
+/*
+ * DHDOC sizeof-ubyte
+ */
+DHDOC(K_sizeof_ubyte_R020071d6,X_sizeof_ubyte,"C_sizeof_ubyte",0,0) = {
+DH_FUNC(0),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB peek-short
+ */
+DH(X_peek_short)
+{
+dharg ret;
+ret.dh_int =  C_peek_short((short * )a[1].dh_gptr);
+return ret;
+}
+
+/*
+ * DHDOC peek-short
+ */
+DHDOC(K_peek_short_R6d6f2621,X_peek_short,"C_peek_short",0,0) = {
+DH_FUNC(1),
+DH_GPTR("short *"),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB poke-short
+ */
+DH(X_poke_short)
+{
+dharg ret;
+ret.dh_int =  C_poke_short((short * )a[1].dh_gptr, a[2].dh_short);
+return ret;
+}
+
+/*
+ * DHDOC poke-short
+ */
+DHDOC(K_poke_short_R86f0e9a2,X_poke_short,"C_poke_short",0,0) = {
+DH_FUNC(2),
+DH_GPTR("short *"),
+DH_SHORT,
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB sizeof-short
+ */
+DH(X_sizeof_short)
+{
+dharg ret;
+ret.dh_int =  C_sizeof_short();
+return ret;
+}
+
+/*
+ * DHDOC sizeof-short
+ */
+DHDOC(K_sizeof_short_R020071d6,X_sizeof_short,"C_sizeof_short",0,0) = {
+DH_FUNC(0),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB peek-int
+ */
+DH(X_peek_int)
+{
+dharg ret;
+ret.dh_int =  C_peek_int((int * )a[1].dh_gptr);
+return ret;
+}
+
+/*
+ * DHDOC peek-int
+ */
+DHDOC(K_peek_int_R6d6f2621,X_peek_int,"C_peek_int",0,0) = {
+DH_FUNC(1),
+DH_GPTR("int *"),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB poke-int
+ */
+DH(X_poke_int)
+{
+dharg ret;
+ret.dh_int =  C_poke_int((int * )a[1].dh_gptr, a[2].dh_int);
+return ret;
+}
+
+/*
+ * DHDOC poke-int
+ */
+DHDOC(K_poke_int_R83b7eb96,X_poke_int,"C_poke_int",0,0) = {
+DH_FUNC(2),
+DH_GPTR("int *"),
+DH_INT,
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB sizeof-int
+ */
+DH(X_sizeof_int)
+{
+dharg ret;
+ret.dh_int =  C_sizeof_int();
+return ret;
+}
+
+/*
+ * DHDOC sizeof-int
+ */
+DHDOC(K_sizeof_int_R020071d6,X_sizeof_int,"C_sizeof_int",0,0) = {
+DH_FUNC(0),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB peek-float
+ */
+DH(X_peek_float)
+{
+dharg ret;
+ret.dh_float =  C_peek_float((float * )a[1].dh_gptr);
+return ret;
+}
+
+/*
+ * DHDOC peek-float
+ */
+DHDOC(K_peek_float_R6dc748c4,X_peek_float,"C_peek_float",0,0) = {
+DH_FUNC(1),
+DH_GPTR("float *"),
+DH_RETURN,
+DH_FLOAT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB poke-float
+ */
+DH(X_poke_float)
+{
+dharg ret;
+ret.dh_float =  C_poke_float((float * )a[1].dh_gptr, a[2].dh_float);
+return ret;
+}
+
+/*
+ * DHDOC poke-float
+ */
+DHDOC(K_poke_float_R865cf25b,X_poke_float,"C_poke_float",0,0) = {
+DH_FUNC(2),
+DH_GPTR("float *"),
+DH_FLOAT,
+DH_RETURN,
+DH_FLOAT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB sizeof-float
+ */
+DH(X_sizeof_float)
+{
+dharg ret;
+ret.dh_int =  C_sizeof_float();
+return ret;
+}
+
+/*
+ * DHDOC sizeof-float
+ */
+DHDOC(K_sizeof_float_R020071d6,X_sizeof_float,"C_sizeof_float",0,0) = {
+DH_FUNC(0),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB peek-double
+ */
+DH(X_peek_double)
+{
+dharg ret;
+ret.dh_double =  C_peek_double((double * )a[1].dh_gptr);
+return ret;
+}
+
+/*
+ * DHDOC peek-double
+ */
+DHDOC(K_peek_double_Rcd548645,X_peek_double,"C_peek_double",0,0) = {
+DH_FUNC(1),
+DH_GPTR("double *"),
+DH_RETURN,
+DH_DOUBLE,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB poke-double
+ */
+DH(X_poke_double)
+{
+dharg ret;
+ret.dh_double =  C_poke_double((double * )a[1].dh_gptr, a[2].dh_double);
+return ret;
+}
+
+/*
+ * DHDOC poke-double
+ */
+DHDOC(K_poke_double_R225148d7,X_poke_double,"C_poke_double",0,0) = {
+DH_FUNC(2),
+DH_GPTR("double *"),
+DH_DOUBLE,
+DH_RETURN,
+DH_DOUBLE,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB sizeof-double
+ */
+DH(X_sizeof_double)
+{
+dharg ret;
+ret.dh_int =  C_sizeof_double();
+return ret;
+}
+
+/*
+ * DHDOC sizeof-double
+ */
+DHDOC(K_sizeof_double_R020071d6,X_sizeof_double,"C_sizeof_double",0,0) = {
+DH_FUNC(0),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB peek-gptr
+ */
+DH(X_peek_gptr)
+{
+dharg ret;
+ret.dh_gptr =  C_peek_gptr((gptr * )a[1].dh_gptr);
+return ret;
+}
+
+/*
+ * DHDOC peek-gptr
+ */
+DHDOC(K_peek_gptr_R4b6fea6a,X_peek_gptr,"C_peek_gptr",0,0) = {
+DH_FUNC(1),
+DH_GPTR("gptr *"),
+DH_RETURN,
+DH_GPTR(0),
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB poke-gptr
+ */
+DH(X_poke_gptr)
+{
+dharg ret;
+ret.dh_gptr =  C_poke_gptr((gptr * )a[1].dh_gptr, a[2].dh_gptr);
+return ret;
+}
+
+/*
+ * DHDOC poke-gptr
+ */
+DHDOC(K_poke_gptr_R95b14584,X_poke_gptr,"C_poke_gptr",0,0) = {
+DH_FUNC(2),
+DH_GPTR("gptr *"),
+DH_GPTR(0),
+DH_RETURN,
+DH_GPTR(0),
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * STUB sizeof-gptr
+ */
+DH(X_sizeof_gptr)
+{
+dharg ret;
+ret.dh_int =  C_sizeof_gptr();
+return ret;
+}
+
+/*
+ * DHDOC sizeof-gptr
+ */
+DHDOC(K_sizeof_gptr_R020071d6,X_sizeof_gptr,"C_sizeof_gptr",0,0) = {
+DH_FUNC(0),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * INIT FUNCTION
+ */
+extern_c void init_libc(void)
+{
+ dh_define("little-endianp", &K_little_endianp_Ra8b05737); 
+ dh_define("malloc", &K_malloc_R7b698833); 
+ dh_define("free", &K_free_Rc7df00c0); 
+ dh_define("memcpy", &K_memcpy_R94ba92aa); 
+ dh_define("peek-ubyte", &K_peek_ubyte_R6d6f2621); 
+ dh_define("poke-ubyte", &K_poke_ubyte_Rd734da6f); 
+ dh_define("sizeof-ubyte", &K_sizeof_ubyte_R020071d6); 
+ dh_define("peek-short", &K_peek_short_R6d6f2621); 
+ dh_define("poke-short", &K_poke_short_R86f0e9a2); 
+ dh_define("sizeof-short", &K_sizeof_short_R020071d6); 
+ dh_define("peek-int", &K_peek_int_R6d6f2621); 
+ dh_define("poke-int", &K_poke_int_R83b7eb96); 
+ dh_define("sizeof-int", &K_sizeof_int_R020071d6); 
+ dh_define("peek-float", &K_peek_float_R6dc748c4); 
+ dh_define("poke-float", &K_poke_float_R865cf25b); 
+ dh_define("sizeof-float", &K_sizeof_float_R020071d6); 
+ dh_define("peek-double", &K_peek_double_Rcd548645); 
+ dh_define("poke-double", &K_poke_double_R225148d7); 
+ dh_define("sizeof-double", &K_sizeof_double_R020071d6); 
+ dh_define("peek-gptr", &K_peek_gptr_R4b6fea6a); 
+ dh_define("poke-gptr", &K_poke_gptr_R95b14584); 
+ dh_define("sizeof-gptr", &K_sizeof_gptr_R020071d6); 
+}
+
+int majver_libc = 50;
+int minver_libc = 01;
+
+
+#endif
+
@@ -0,0 +1,143 @@
+/* WARNING: Automatically generated code.
+ * This code has been generated by the DH compiler.
+ */
+#ifdef HAVE_CONFIG_H
+# include "lushconf.h"
+#endif
+
+/*
+ * LUSH HEADERS
+ */
+#include "header.h"
+#include "dh.h"
+#include "idxmac.h"
+#include "idxops.h"
+#include "check_func.h"
+#undef uchar
+
+/*
+ * DECLARATIONS
+ */
+extern_c struct VClass_object Vt_object;
+struct CClass_object;
+struct CClass_iterator {
+  struct VClass_iterator *Vtbl;  class_t  *__lcl;  object_t *__lptr;
+bool  next_item_valid;
+};
+struct VClass_iterator {
+  void *Cdoc;
+  void (*Cdestroy)(struct CClass_iterator *);  void (*__mark)(struct CClass_iterator *);
+bool  (*M_iterator) ( struct CClass_iterator *  );
+};
+extern_c struct VClass_iterator Vt_iterator;
+extern_c bool  C_iterator_C_iterator ( struct CClass_iterator *  );
+
+
+/* ---------------------------------------- */
+
+
+/*
+ * METHOD FUNCTION iterator (class iterator)
+ */
+extern_c bool C_iterator_C_iterator(struct CClass_iterator * L1_this)
+{
+TRACE_PUSH("C_iterator_C_iterator"); MM_ENTER;
+{
+bool L_Tmp0;
+L1_this->next_item_valid = 0;
+L_Tmp0 = L1_this->next_item_valid;
+TRACE_POP("C_iterator_C_iterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * CLASS iterator DESTROY
+ */
+static void Cdestroy_C_iterator(struct CClass_iterator *g)
+
+{
+assert(g->Vtbl);
+struct VClass_object *super = (struct VClass_object *)(void *)(&Vt_object);
+super->Cdestroy((struct CClass_object *)g);
+g->Vtbl = NULL;
+}
+
+/*
+ * METHOD FUNCTION __mark (class iterator)
+ */
+static void C__mark_C_iterator(struct CClass_iterator *obj)
+
+{
+
+}
+
+/*
+ * CLASS iterator VTABLE
+ */
+struct VClass_iterator Vt_iterator = {
+(void*)&Vt_object,
+&Cdestroy_C_iterator,
+&C__mark_C_iterator,
+&C_iterator_C_iterator,
+};
+
+/* ---------------------------------------- */
+
+#ifndef NOLISP
+
+/* Declarations */
+extern_c dhclassdoc_t Kc_object;
+extern_c dhclassdoc_t Kc_iterator_R8c846d6e;
+
+
+/*
+ * METHOD STUB iterator (class iterator)
+ */
+DH(X_iterator_C_iterator)
+{
+dharg ret;
+ret.dh_bool =  C_iterator_C_iterator((struct CClass_iterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC iterator (class iterator)
+ */
+DHDOC(K_iterator_C_iterator_Rf3df4769,X_iterator_C_iterator,"C_iterator_C_iterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_iterator_R8c846d6e),
+DH_RETURN,
+DH_BOOL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * CLASS iterator DHCLASSDOC
+ */
+DHCLASSDOC(Kc_iterator_R8c846d6e, &Kc_object, iterator, "iterator", Vt_iterator, 1) =
+{
+DH_CLASS(1, Kc_iterator_R8c846d6e),
+DH_NAME("next-item-valid",iterator,next_item_valid),
+DH_BOOL,
+DH_END_CLASS,
+DH_METHOD("iterator",K_iterator_C_iterator_Rf3df4769),
+DH_NIL
+};
+
+/*
+ * INIT FUNCTION
+ */
+extern_c void init_iterator_base_class(void)
+{
+ dhclass_define("iterator", &Kc_iterator_R8c846d6e);
+ dhmethod_define(&Kc_iterator_R8c846d6e, "iterator", &K_iterator_C_iterator_Rf3df4769);
+}
+
+int majver_iterator_base_class = 50;
+int minver_iterator_base_class = 01;
+
+
+#endif
+
@@ -0,0 +1,1817 @@
+/* WARNING: Automatically generated code.
+ * This code has been generated by the DH compiler.
+ */
+#ifdef HAVE_CONFIG_H
+# include "lushconf.h"
+#endif
+
+/*
+ * LUSH HEADERS
+ */
+#include "header.h"
+#include "dh.h"
+#include "idxmac.h"
+#include "idxops.h"
+#include "check_func.h"
+#undef uchar
+/*
+ * USER DEFINED HEADERS
+ */
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <stdint.h>
+#include <errno.h>
+#include <stdio.h>
+
+/*
+ * DECLARATIONS
+ */
+extern_c struct VClass_iterator Vt_iterator;
+struct CClass_iterator;
+extern_c struct VClass_object Vt_object;
+struct CClass_object;
+struct CClass_RangeIterator {
+  struct VClass_RangeIterator *Vtbl;  class_t  *__lcl;  object_t *__lptr;
+bool  next_item_valid;
+int  next_item;
+int  to;
+int  step;
+};
+struct VClass_RangeIterator {
+  void *Cdoc;
+  void (*Cdestroy)(struct CClass_RangeIterator *);  void (*__mark)(struct CClass_RangeIterator *);
+bool  (*M_iterator) ( struct CClass_iterator *  );
+struct CClass_RangeIterator *  (*M__iterate) ( struct CClass_RangeIterator *  );
+bool  (*M__make_next) ( struct CClass_RangeIterator *  );
+bool  (*M__emptyp) ( struct CClass_RangeIterator *  );
+int  (*M_peeknext) ( struct CClass_RangeIterator *  );
+int  (*M_next) ( struct CClass_RangeIterator *  );
+int  (*M_RangeIterator) ( struct CClass_RangeIterator * , int , int , int  );
+};
+extern_c struct VClass_RangeIterator Vt_RangeIterator;
+extern_c bool  C_iterator_C_iterator ( struct CClass_iterator *  );
+extern_c struct CClass_RangeIterator *  C__iterate_C_RangeIterator ( struct CClass_RangeIterator *  );
+extern_c bool  C__make_next_C_RangeIterator ( struct CClass_RangeIterator *  );
+extern_c bool  C__emptyp_C_RangeIterator ( struct CClass_RangeIterator *  );
+extern_c int  C_peeknext_C_RangeIterator ( struct CClass_RangeIterator *  );
+extern_c int  C_next_C_RangeIterator ( struct CClass_RangeIterator *  );
+extern_c int  C_RangeIterator_C_RangeIterator ( struct CClass_RangeIterator * , int , int , int  );
+struct CClass_RangeSIterator {
+  struct VClass_RangeSIterator *Vtbl;  class_t  *__lcl;  object_t *__lptr;
+bool  next_item_valid;
+int  next_item;
+int  to;
+int  step;
+};
+struct VClass_RangeSIterator {
+  void *Cdoc;
+  void (*Cdestroy)(struct CClass_RangeSIterator *);  void (*__mark)(struct CClass_RangeSIterator *);
+bool  (*M_iterator) ( struct CClass_iterator *  );
+struct CClass_RangeIterator *  (*M__iterate) ( struct CClass_RangeIterator *  );
+bool  (*M__make_next) ( struct CClass_RangeSIterator *  );
+bool  (*M__emptyp) ( struct CClass_RangeIterator *  );
+int  (*M_peeknext) ( struct CClass_RangeIterator *  );
+int  (*M_next) ( struct CClass_RangeIterator *  );
+int  (*M_RangeIterator) ( struct CClass_RangeIterator * , int , int , int  );
+int  (*M_RangeSIterator) ( struct CClass_RangeSIterator * , int , int , int  );
+};
+extern_c struct VClass_RangeSIterator Vt_RangeSIterator;
+extern_c bool  C__make_next_C_RangeSIterator ( struct CClass_RangeSIterator *  );
+extern_c int  C_RangeSIterator_C_RangeSIterator ( struct CClass_RangeSIterator * , int , int , int  );
+struct CClass_FibonacciIterator {
+  struct VClass_FibonacciIterator *Vtbl;  class_t  *__lcl;  object_t *__lptr;
+bool  next_item_valid;
+int  f;
+int  next_item;
+};
+struct VClass_FibonacciIterator {
+  void *Cdoc;
+  void (*Cdestroy)(struct CClass_FibonacciIterator *);  void (*__mark)(struct CClass_FibonacciIterator *);
+bool  (*M_iterator) ( struct CClass_iterator *  );
+struct CClass_FibonacciIterator *  (*M__iterate) ( struct CClass_FibonacciIterator *  );
+bool  (*M__make_next) ( struct CClass_FibonacciIterator *  );
+bool  (*M__emptyp) ( struct CClass_FibonacciIterator *  );
+int  (*M_peeknext) ( struct CClass_FibonacciIterator *  );
+int  (*M_next) ( struct CClass_FibonacciIterator *  );
+bool  (*M_FibonacciIterator) ( struct CClass_FibonacciIterator *  );
+};
+extern_c struct VClass_FibonacciIterator Vt_FibonacciIterator;
+extern_c struct CClass_FibonacciIterator *  C__iterate_C_FibonacciIterator ( struct CClass_FibonacciIterator *  );
+extern_c bool  C__make_next_C_FibonacciIterator ( struct CClass_FibonacciIterator *  );
+extern_c bool  C__emptyp_C_FibonacciIterator ( struct CClass_FibonacciIterator *  );
+extern_c int  C_peeknext_C_FibonacciIterator ( struct CClass_FibonacciIterator *  );
+extern_c int  C_next_C_FibonacciIterator ( struct CClass_FibonacciIterator *  );
+extern_c bool  C_FibonacciIterator_C_FibonacciIterator ( struct CClass_FibonacciIterator *  );
+struct CClass_RangeShuffledIterator {
+  struct VClass_RangeShuffledIterator *Vtbl;  class_t  *__lcl;  object_t *__lptr;
+bool  next_item_valid;
+int  next_item;
+int  from;
+int  to;
+int  x;
+int  N;
+int  A;
+int  B;
+int  count;
+};
+struct VClass_RangeShuffledIterator {
+  void *Cdoc;
+  void (*Cdestroy)(struct CClass_RangeShuffledIterator *);  void (*__mark)(struct CClass_RangeShuffledIterator *);
+bool  (*M_iterator) ( struct CClass_iterator *  );
+struct CClass_RangeShuffledIterator *  (*M__iterate) ( struct CClass_RangeShuffledIterator *  );
+bool  (*M__make_next) ( struct CClass_RangeShuffledIterator *  );
+bool  (*M__emptyp) ( struct CClass_RangeShuffledIterator *  );
+int  (*M_peeknext) ( struct CClass_RangeShuffledIterator *  );
+int  (*M_next) ( struct CClass_RangeShuffledIterator *  );
+bool  (*M_RangeShuffledIterator) ( struct CClass_RangeShuffledIterator * , int , int  );
+};
+extern_c struct VClass_RangeShuffledIterator Vt_RangeShuffledIterator;
+extern_c struct CClass_RangeShuffledIterator *  C__iterate_C_RangeShuffledIterator ( struct CClass_RangeShuffledIterator *  );
+extern_c bool  C__make_next_C_RangeShuffledIterator ( struct CClass_RangeShuffledIterator *  );
+extern_c bool  C__emptyp_C_RangeShuffledIterator ( struct CClass_RangeShuffledIterator *  );
+extern_c int  C_peeknext_C_RangeShuffledIterator ( struct CClass_RangeShuffledIterator *  );
+extern_c int  C_next_C_RangeShuffledIterator ( struct CClass_RangeShuffledIterator *  );
+extern_c bool  C_RangeShuffledIterator_C_RangeShuffledIterator ( struct CClass_RangeShuffledIterator * , int , int  );
+struct CClass_LinesSIterator {
+  struct VClass_LinesSIterator *Vtbl;  class_t  *__lcl;  object_t *__lptr;
+bool  next_item_valid;
+FILE *  f;
+char *  base;
+int  n;
+index_t *  next_item;
+};
+struct VClass_LinesSIterator {
+  void *Cdoc;
+  void (*Cdestroy)(struct CClass_LinesSIterator *);  void (*__mark)(struct CClass_LinesSIterator *);
+bool  (*M_iterator) ( struct CClass_iterator *  );
+struct CClass_LinesSIterator *  (*M__iterate) ( struct CClass_LinesSIterator *  );
+bool  (*M__make_next) ( struct CClass_LinesSIterator *  );
+bool  (*M__emptyp) ( struct CClass_LinesSIterator *  );
+index_t *  (*M_peeknext) ( struct CClass_LinesSIterator *  );
+index_t *  (*M_next) ( struct CClass_LinesSIterator *  );
+bool  (*M__mmap_storage) ( struct CClass_LinesSIterator * , char* , storage_t *  );
+bool  (*M_LinesSIterator) ( struct CClass_LinesSIterator * , char*  );
+bool  (*M__destructor) ( struct CClass_LinesSIterator *  );
+};
+extern_c struct VClass_LinesSIterator Vt_LinesSIterator;
+extern_c struct CClass_LinesSIterator *  C__iterate_C_LinesSIterator ( struct CClass_LinesSIterator *  );
+extern_c bool  C__make_next_C_LinesSIterator ( struct CClass_LinesSIterator *  );
+extern_c bool  C__emptyp_C_LinesSIterator ( struct CClass_LinesSIterator *  );
+extern_c index_t *  C_peeknext_C_LinesSIterator ( struct CClass_LinesSIterator *  );
+extern_c index_t *  C_next_C_LinesSIterator ( struct CClass_LinesSIterator *  );
+extern_c bool  C__mmap_storage_C_LinesSIterator ( struct CClass_LinesSIterator * , char* , storage_t *  );
+extern_c bool  C_LinesSIterator_C_LinesSIterator ( struct CClass_LinesSIterator * , char*  );
+extern_c bool  C__destructor_C_LinesSIterator ( struct CClass_LinesSIterator *  );
+
+
+/* ---------------------------------------- */
+
+
+/*
+ * METHOD FUNCTION -iterate (class RangeIterator)
+ */
+extern_c struct CClass_RangeIterator * C__iterate_C_RangeIterator(struct CClass_RangeIterator * L1_this)
+{
+TRACE_PUSH("C__iterate_C_RangeIterator"); MM_ENTER;
+{
+struct CClass_RangeIterator * L_Tmp0;
+L_Tmp0 = L1_this;
+TRACE_POP("C__iterate_C_RangeIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION -make-next (class RangeIterator)
+ */
+extern_c bool C__make_next_C_RangeIterator(struct CClass_RangeIterator * L1_this)
+{
+TRACE_PUSH("C__make_next_C_RangeIterator"); MM_ENTER;
+{
+L1_this->next_item = (L1_this->next_item+L1_this->step);
+ if ((L1_this->step>0)) { 
+L1_this->next_item_valid = (L1_this->next_item<=L1_this->to);
+ } else { 
+L1_this->next_item_valid = (L1_this->next_item>=L1_this->to);
+ } 
+TRACE_POP("C__make_next_C_RangeIterator");
+MM_EXIT; return 0;
+}
+}
+
+/*
+ * METHOD FUNCTION -emptyp (class RangeIterator)
+ */
+extern_c bool C__emptyp_C_RangeIterator(struct CClass_RangeIterator * L1_this)
+{
+TRACE_PUSH("C__emptyp_C_RangeIterator"); MM_ENTER;
+{
+bool L_Tmp0;
+ if (!(L1_this->next_item_valid)) { 
+(L1_this)->Vtbl->M__make_next(L1_this);
+ } 
+L_Tmp0 = L1_this->next_item_valid;
+L_Tmp0 = !(L_Tmp0);
+TRACE_POP("C__emptyp_C_RangeIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION peeknext (class RangeIterator)
+ */
+extern_c int C_peeknext_C_RangeIterator(struct CClass_RangeIterator * L1_this)
+{
+TRACE_PUSH("C_peeknext_C_RangeIterator"); MM_ENTER;
+{
+int L_Tmp0;
+ if (!(L1_this->next_item_valid)) { 
+(L1_this)->Vtbl->M__make_next(L1_this);
+ } 
+ if (!(L1_this->next_item_valid)) { 
+lush_error("No more items");
+ } 
+L_Tmp0 = L1_this->next_item;
+TRACE_POP("C_peeknext_C_RangeIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION next (class RangeIterator)
+ */
+extern_c int C_next_C_RangeIterator(struct CClass_RangeIterator * L1_this)
+{
+TRACE_PUSH("C_next_C_RangeIterator"); MM_ENTER;
+{
+int L_Tmp0;
+ if (!(L1_this->next_item_valid)) { 
+(L1_this)->Vtbl->M__make_next(L1_this);
+ } 
+ if (!(L1_this->next_item_valid)) { 
+lush_error("No more items");
+ } 
+L1_this->next_item_valid = 0;
+L_Tmp0 = L1_this->next_item;
+TRACE_POP("C_next_C_RangeIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION RangeIterator (class RangeIterator)
+ */
+extern_c int C_RangeIterator_C_RangeIterator(struct CClass_RangeIterator * L1_this,int L1_from,int L1_to,int L1_step)
+{
+TRACE_PUSH("C_RangeIterator_C_RangeIterator"); MM_ENTER;
+{
+int L_Tmp0;
+(L1_this)->Vtbl->M_iterator((struct CClass_iterator *)(L1_this));
+L1_this->next_item = L1_from;
+L1_this->to = L1_to;
+L1_this->step = L1_step;
+(L1_this)->Vtbl->M__make_next(L1_this);
+L1_this->next_item = L1_from;
+L_Tmp0 = L1_this->next_item;
+TRACE_POP("C_RangeIterator_C_RangeIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * CLASS RangeIterator DESTROY
+ */
+static void Cdestroy_C_RangeIterator(struct CClass_RangeIterator *g)
+
+{
+assert(g->Vtbl);
+struct VClass_object *super = (struct VClass_object *)(void *)(&Vt_iterator);
+super->Cdestroy((struct CClass_object *)g);
+g->Vtbl = NULL;
+}
+
+/*
+ * METHOD FUNCTION __mark (class RangeIterator)
+ */
+static void C__mark_C_RangeIterator(struct CClass_RangeIterator *obj)
+
+{
+
+
+
+
+}
+
+/*
+ * CLASS RangeIterator VTABLE
+ */
+struct VClass_RangeIterator Vt_RangeIterator = {
+(void*)&Vt_iterator,
+&Cdestroy_C_RangeIterator,
+&C__mark_C_RangeIterator,
+&C_iterator_C_iterator,
+&C__iterate_C_RangeIterator,
+&C__make_next_C_RangeIterator,
+&C__emptyp_C_RangeIterator,
+&C_peeknext_C_RangeIterator,
+&C_next_C_RangeIterator,
+&C_RangeIterator_C_RangeIterator,
+};
+
+/*
+ * METHOD FUNCTION Range*Iterator (class Range*Iterator)
+ */
+extern_c int C_RangeSIterator_C_RangeSIterator(struct CClass_RangeSIterator * L1_this,int L1_from,int L1_to,int L1_step)
+{
+TRACE_PUSH("C_RangeSIterator_C_RangeSIterator"); MM_ENTER;
+{
+int L_Tmp0;
+L_Tmp0 = (L1_this)->Vtbl->M_RangeIterator((struct CClass_RangeIterator *)(L1_this), L1_from, L1_to, L1_step);
+TRACE_POP("C_RangeSIterator_C_RangeSIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION -make-next (class Range*Iterator)
+ */
+extern_c bool C__make_next_C_RangeSIterator(struct CClass_RangeSIterator * L1_this)
+{
+TRACE_PUSH("C__make_next_C_RangeSIterator"); MM_ENTER;
+{
+L1_this->next_item = (L1_this->next_item+L1_this->step);
+ if ((L1_this->step>0)) { 
+L1_this->next_item_valid = (L1_this->next_item<L1_this->to);
+ } else { 
+L1_this->next_item_valid = (L1_this->next_item>L1_this->to);
+ } 
+TRACE_POP("C__make_next_C_RangeSIterator");
+MM_EXIT; return 0;
+}
+}
+
+/*
+ * CLASS Range*Iterator DESTROY
+ */
+static void Cdestroy_C_RangeSIterator(struct CClass_RangeSIterator *g)
+
+{
+assert(g->Vtbl);
+struct VClass_object *super = (struct VClass_object *)(void *)(&Vt_RangeIterator);
+super->Cdestroy((struct CClass_object *)g);
+g->Vtbl = NULL;
+}
+
+/*
+ * METHOD FUNCTION __mark (class RangeSIterator)
+ */
+static void C__mark_C_RangeSIterator(struct CClass_RangeSIterator *obj)
+
+{
+
+
+
+
+}
+
+/*
+ * CLASS Range*Iterator VTABLE
+ */
+struct VClass_RangeSIterator Vt_RangeSIterator = {
+(void*)&Vt_RangeIterator,
+&Cdestroy_C_RangeSIterator,
+&C__mark_C_RangeSIterator,
+&C_iterator_C_iterator,
+&C__iterate_C_RangeIterator,
+&C__make_next_C_RangeSIterator,
+&C__emptyp_C_RangeIterator,
+&C_peeknext_C_RangeIterator,
+&C_next_C_RangeIterator,
+&C_RangeIterator_C_RangeIterator,
+&C_RangeSIterator_C_RangeSIterator,
+};
+
+/*
+ * METHOD FUNCTION -iterate (class FibonacciIterator)
+ */
+extern_c struct CClass_FibonacciIterator * C__iterate_C_FibonacciIterator(struct CClass_FibonacciIterator * L1_this)
+{
+TRACE_PUSH("C__iterate_C_FibonacciIterator"); MM_ENTER;
+{
+struct CClass_FibonacciIterator * L_Tmp0;
+L_Tmp0 = L1_this;
+TRACE_POP("C__iterate_C_FibonacciIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION -make-next (class FibonacciIterator)
+ */
+extern_c bool C__make_next_C_FibonacciIterator(struct CClass_FibonacciIterator * L1_this)
+{
+TRACE_PUSH("C__make_next_C_FibonacciIterator"); MM_ENTER;
+{
+bool L_Tmp0;
+{
+int L2_1_g;
+L2_1_g = (L1_this->next_item+L1_this->f);
+L1_this->next_item = L1_this->f;
+L1_this->next_item_valid = true;
+L1_this->f = L2_1_g;
+L_Tmp0 = 0;
+}
+TRACE_POP("C__make_next_C_FibonacciIterator");
+MM_EXIT; return 0;
+}
+}
+
+/*
+ * METHOD FUNCTION -emptyp (class FibonacciIterator)
+ */
+extern_c bool C__emptyp_C_FibonacciIterator(struct CClass_FibonacciIterator * L1_this)
+{
+TRACE_PUSH("C__emptyp_C_FibonacciIterator"); MM_ENTER;
+{
+bool L_Tmp0;
+ if (!(L1_this->next_item_valid)) { 
+(L1_this)->Vtbl->M__make_next(L1_this);
+ } 
+L_Tmp0 = L1_this->next_item_valid;
+L_Tmp0 = !(L_Tmp0);
+TRACE_POP("C__emptyp_C_FibonacciIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION peeknext (class FibonacciIterator)
+ */
+extern_c int C_peeknext_C_FibonacciIterator(struct CClass_FibonacciIterator * L1_this)
+{
+TRACE_PUSH("C_peeknext_C_FibonacciIterator"); MM_ENTER;
+{
+int L_Tmp0;
+ if (!(L1_this->next_item_valid)) { 
+(L1_this)->Vtbl->M__make_next(L1_this);
+ } 
+ if (!(L1_this->next_item_valid)) { 
+lush_error("No more items");
+ } 
+L_Tmp0 = L1_this->next_item;
+TRACE_POP("C_peeknext_C_FibonacciIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION next (class FibonacciIterator)
+ */
+extern_c int C_next_C_FibonacciIterator(struct CClass_FibonacciIterator * L1_this)
+{
+TRACE_PUSH("C_next_C_FibonacciIterator"); MM_ENTER;
+{
+int L_Tmp0;
+ if (!(L1_this->next_item_valid)) { 
+(L1_this)->Vtbl->M__make_next(L1_this);
+ } 
+ if (!(L1_this->next_item_valid)) { 
+lush_error("No more items");
+ } 
+L1_this->next_item_valid = 0;
+L_Tmp0 = L1_this->next_item;
+TRACE_POP("C_next_C_FibonacciIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION FibonacciIterator (class FibonacciIterator)
+ */
+extern_c bool C_FibonacciIterator_C_FibonacciIterator(struct CClass_FibonacciIterator * L1_this)
+{
+TRACE_PUSH("C_FibonacciIterator_C_FibonacciIterator"); MM_ENTER;
+{
+bool L_Tmp0;
+(L1_this)->Vtbl->M_iterator((struct CClass_iterator *)(L1_this));
+L1_this->f = 1;
+L1_this->next_item = 0;
+L1_this->next_item_valid = true;
+L_Tmp0 = L1_this->next_item_valid;
+TRACE_POP("C_FibonacciIterator_C_FibonacciIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * CLASS FibonacciIterator DESTROY
+ */
+static void Cdestroy_C_FibonacciIterator(struct CClass_FibonacciIterator *g)
+
+{
+assert(g->Vtbl);
+struct VClass_object *super = (struct VClass_object *)(void *)(&Vt_iterator);
+super->Cdestroy((struct CClass_object *)g);
+g->Vtbl = NULL;
+}
+
+/*
+ * METHOD FUNCTION __mark (class FibonacciIterator)
+ */
+static void C__mark_C_FibonacciIterator(struct CClass_FibonacciIterator *obj)
+
+{
+
+
+
+}
+
+/*
+ * CLASS FibonacciIterator VTABLE
+ */
+struct VClass_FibonacciIterator Vt_FibonacciIterator = {
+(void*)&Vt_iterator,
+&Cdestroy_C_FibonacciIterator,
+&C__mark_C_FibonacciIterator,
+&C_iterator_C_iterator,
+&C__iterate_C_FibonacciIterator,
+&C__make_next_C_FibonacciIterator,
+&C__emptyp_C_FibonacciIterator,
+&C_peeknext_C_FibonacciIterator,
+&C_next_C_FibonacciIterator,
+&C_FibonacciIterator_C_FibonacciIterator,
+};
+
+/*
+ * METHOD FUNCTION -iterate (class RangeShuffledIterator)
+ */
+extern_c struct CClass_RangeShuffledIterator * C__iterate_C_RangeShuffledIterator(struct CClass_RangeShuffledIterator * L1_this)
+{
+TRACE_PUSH("C__iterate_C_RangeShuffledIterator"); MM_ENTER;
+{
+struct CClass_RangeShuffledIterator * L_Tmp0;
+L_Tmp0 = L1_this;
+TRACE_POP("C__iterate_C_RangeShuffledIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION -make-next (class RangeShuffledIterator)
+ */
+extern_c bool C__make_next_C_RangeShuffledIterator(struct CClass_RangeShuffledIterator * L1_this)
+{
+TRACE_PUSH("C__make_next_C_RangeShuffledIterator"); MM_ENTER;
+{
+ if ((L1_this->count>0)) { 
+/* Do-while loop */
+
+{
+MM_ENTER;
+L_0:
+
+{
+{
+double L3_0_x;
+double L3_1_y;
+L3_0_x = (L1_this->x+L1_this->A);
+L3_1_y = L1_this->B;
+L1_this->x = (L3_0_x-(Dfloor((((double)L3_0_x)/((double)L3_1_y)))*L3_1_y));
+}
+}
+/* Do-while loop test*/
+
+{
+MM_EXIT;
+
+if ((L1_this->x>=L1_this->N)) goto L_0;
+
+}
+}
+L1_this->next_item = (L1_this->x+L1_this->from);
+L1_this->next_item_valid = true;
+L1_this->count = (L1_this->count+(0-1));
+ } 
+TRACE_POP("C__make_next_C_RangeShuffledIterator");
+MM_EXIT; return 0;
+}
+}
+
+/*
+ * METHOD FUNCTION -emptyp (class RangeShuffledIterator)
+ */
+extern_c bool C__emptyp_C_RangeShuffledIterator(struct CClass_RangeShuffledIterator * L1_this)
+{
+TRACE_PUSH("C__emptyp_C_RangeShuffledIterator"); MM_ENTER;
+{
+bool L_Tmp0;
+ if (!(L1_this->next_item_valid)) { 
+(L1_this)->Vtbl->M__make_next(L1_this);
+ } 
+L_Tmp0 = L1_this->next_item_valid;
+L_Tmp0 = !(L_Tmp0);
+TRACE_POP("C__emptyp_C_RangeShuffledIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION peeknext (class RangeShuffledIterator)
+ */
+extern_c int C_peeknext_C_RangeShuffledIterator(struct CClass_RangeShuffledIterator * L1_this)
+{
+TRACE_PUSH("C_peeknext_C_RangeShuffledIterator"); MM_ENTER;
+{
+int L_Tmp0;
+ if (!(L1_this->next_item_valid)) { 
+(L1_this)->Vtbl->M__make_next(L1_this);
+ } 
+ if (!(L1_this->next_item_valid)) { 
+lush_error("No more items");
+ } 
+L_Tmp0 = L1_this->next_item;
+TRACE_POP("C_peeknext_C_RangeShuffledIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION next (class RangeShuffledIterator)
+ */
+extern_c int C_next_C_RangeShuffledIterator(struct CClass_RangeShuffledIterator * L1_this)
+{
+TRACE_PUSH("C_next_C_RangeShuffledIterator"); MM_ENTER;
+{
+int L_Tmp0;
+ if (!(L1_this->next_item_valid)) { 
+(L1_this)->Vtbl->M__make_next(L1_this);
+ } 
+ if (!(L1_this->next_item_valid)) { 
+lush_error("No more items");
+ } 
+L1_this->next_item_valid = 0;
+L_Tmp0 = L1_this->next_item;
+TRACE_POP("C_next_C_RangeShuffledIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION RangeShuffledIterator (class RangeShuffledIterator)
+ */
+extern_c bool C_RangeShuffledIterator_C_RangeShuffledIterator(struct CClass_RangeShuffledIterator * L1_this,int L1_from,int L1_to)
+{
+TRACE_PUSH("C_RangeShuffledIterator_C_RangeShuffledIterator"); MM_ENTER;
+{
+(L1_this)->Vtbl->M_iterator((struct CClass_iterator *)(L1_this));
+L1_this->from = L1_from;
+L1_this->to = L1_to;
+{
+double L2_0_a;
+double L2_1_b;
+L2_0_a = 0;
+L2_1_b = (L1_to-L1_from);
+ if ((L2_0_a>L2_1_b)) { 
+L1_this->N = L2_0_a;
+ } else { 
+L1_this->N = L2_1_b;
+ } 
+}
+L1_this->count = L1_this->N;
+{
+struct CClass_FibonacciIterator  L3_2_0_obj_Struct;
+struct CClass_FibonacciIterator  *L3_2_0_obj= &L3_2_0_obj_Struct;
+struct CClass_FibonacciIterator * L2_3_fib;
+int L_Tmp5;
+memset(L3_2_0_obj, 0, sizeof(struct CClass_FibonacciIterator ));
+L3_2_0_obj->Vtbl = &Vt_FibonacciIterator;
+{
+struct CClass_FibonacciIterator * L3_4__x_;
+L3_4__x_ = L3_2_0_obj;
+(L3_4__x_)->Vtbl->M_FibonacciIterator(L3_4__x_);
+L2_3_fib = L3_4__x_;
+}
+/* While loop */
+
+{
+MM_ENTER;
+goto L_1;
+
+L_0:
+
+{
+(L2_3_fib)->Vtbl->M_next(L2_3_fib);
+}
+/* While loop test*/
+
+L_1:
+
+{
+L_Tmp5 = (L2_3_fib)->Vtbl->M_peeknext(L2_3_fib);
+MM_EXIT;
+
+if ((L_Tmp5<L1_this->N)) goto L_0;
+
+}
+}
+L1_this->B = (L2_3_fib)->Vtbl->M_next(L2_3_fib);
+L1_this->A = (L2_3_fib)->Vtbl->M_next(L2_3_fib);
+if (L3_2_0_obj->Vtbl) (L3_2_0_obj->Vtbl->Cdestroy)((gptr)(L3_2_0_obj));
+}
+L1_this->x = 0;
+TRACE_POP("C_RangeShuffledIterator_C_RangeShuffledIterator");
+MM_EXIT; return 0;
+}
+}
+
+/*
+ * CLASS RangeShuffledIterator DESTROY
+ */
+static void Cdestroy_C_RangeShuffledIterator(struct CClass_RangeShuffledIterator *g)
+
+{
+assert(g->Vtbl);
+struct VClass_object *super = (struct VClass_object *)(void *)(&Vt_iterator);
+super->Cdestroy((struct CClass_object *)g);
+g->Vtbl = NULL;
+}
+
+/*
+ * METHOD FUNCTION __mark (class RangeShuffledIterator)
+ */
+static void C__mark_C_RangeShuffledIterator(struct CClass_RangeShuffledIterator *obj)
+
+{
+
+
+
+
+
+
+
+
+
+}
+
+/*
+ * CLASS RangeShuffledIterator VTABLE
+ */
+struct VClass_RangeShuffledIterator Vt_RangeShuffledIterator = {
+(void*)&Vt_iterator,
+&Cdestroy_C_RangeShuffledIterator,
+&C__mark_C_RangeShuffledIterator,
+&C_iterator_C_iterator,
+&C__iterate_C_RangeShuffledIterator,
+&C__make_next_C_RangeShuffledIterator,
+&C__emptyp_C_RangeShuffledIterator,
+&C_peeknext_C_RangeShuffledIterator,
+&C_next_C_RangeShuffledIterator,
+&C_RangeShuffledIterator_C_RangeShuffledIterator,
+};
+
+/*
+ * METHOD FUNCTION -iterate (class Lines*Iterator)
+ */
+extern_c struct CClass_LinesSIterator * C__iterate_C_LinesSIterator(struct CClass_LinesSIterator * L1_this)
+{
+TRACE_PUSH("C__iterate_C_LinesSIterator"); MM_ENTER;
+{
+struct CClass_LinesSIterator * L_Tmp0;
+L_Tmp0 = L1_this;
+TRACE_POP("C__iterate_C_LinesSIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION -make-next (class Lines*Iterator)
+ */
+extern_c bool C__make_next_C_LinesSIterator(struct CClass_LinesSIterator * L1_this)
+{
+TRACE_PUSH("C__make_next_C_LinesSIterator"); MM_ENTER;
+{
+bool L_Tmp0;
+{
+storage_t * L2_1_srg;
+index_t * L2_2_ni;
+bool L2_3_valid;
+L2_1_srg = ((L1_this->next_item)->st);
+L2_2_ni = L1_this->next_item;
+L2_3_valid = 0;
+ if ((bool)( ((L2_2_ni)->offset)<((L2_1_srg)->size))) { 
+
+        (L2_2_ni)->offset += (L1_this->n);
+        size_t n = 0;
+        size_t nmax = (L2_2_ni)->offset < (L2_1_srg)->size ? (L2_1_srg)->size - (L2_2_ni)->offset : 0;
+        char *c = (L1_this->base) + (L2_2_ni)->offset;
+        while (n<nmax && c[n]!='\n') n++;
+        (L1_this->n) = (int)(n + 1);
+        (L2_2_ni)->dim[0] = n;
+        (L2_3_valid) = (nmax>0);
+ } 
+ if (L2_3_valid) { 
+printf("next item valid\n");
+ } else { 
+printf("next item not valid\n");
+ } 
+L1_this->next_item_valid = L2_3_valid;
+L_Tmp0 = 0;
+}
+TRACE_POP("C__make_next_C_LinesSIterator");
+MM_EXIT; return 0;
+}
+}
+
+/*
+ * METHOD FUNCTION -emptyp (class Lines*Iterator)
+ */
+extern_c bool C__emptyp_C_LinesSIterator(struct CClass_LinesSIterator * L1_this)
+{
+TRACE_PUSH("C__emptyp_C_LinesSIterator"); MM_ENTER;
+{
+bool L_Tmp0;
+ if (!(L1_this->next_item_valid)) { 
+(L1_this)->Vtbl->M__make_next(L1_this);
+ } 
+L_Tmp0 = L1_this->next_item_valid;
+L_Tmp0 = !(L_Tmp0);
+TRACE_POP("C__emptyp_C_LinesSIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION peeknext (class Lines*Iterator)
+ */
+extern_c index_t * C_peeknext_C_LinesSIterator(struct CClass_LinesSIterator * L1_this)
+{
+TRACE_PUSH("C_peeknext_C_LinesSIterator"); MM_ENTER;
+{
+index_t * L_Tmp0;
+ if (!(L1_this->next_item_valid)) { 
+(L1_this)->Vtbl->M__make_next(L1_this);
+ } 
+ if (!(L1_this->next_item_valid)) { 
+lush_error("No more items");
+ } 
+L_Tmp0 = L1_this->next_item;
+TRACE_POP("C_peeknext_C_LinesSIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION next (class Lines*Iterator)
+ */
+extern_c index_t * C_next_C_LinesSIterator(struct CClass_LinesSIterator * L1_this)
+{
+TRACE_PUSH("C_next_C_LinesSIterator"); MM_ENTER;
+{
+index_t * L_Tmp0;
+ if (!(L1_this->next_item_valid)) { 
+(L1_this)->Vtbl->M__make_next(L1_this);
+ } 
+ if (!(L1_this->next_item_valid)) { 
+lush_error("No more items");
+ } 
+L1_this->next_item_valid = 0;
+L_Tmp0 = L1_this->next_item;
+TRACE_POP("C_next_C_LinesSIterator");
+MM_EXIT; return L_Tmp0;
+}
+}
+
+/*
+ * METHOD FUNCTION -mmap-storage (class Lines*Iterator)
+ */
+extern_c bool C__mmap_storage_C_LinesSIterator(struct CClass_LinesSIterator * L1_this,char* L1_filename,storage_t * L1_srg)
+{
+TRACE_PUSH("C__mmap_storage_C_LinesSIterator"); MM_ENTER;
+{
+
+  assert((L1_filename)!=NULL);
+
+  (L1_this->f) = fopen((L1_filename), "r");
+  if ((L1_this->f)==NULL)
+    run_time_error("file not found or inaccessible");
+
+  if (fseek((L1_this->f),0,SEEK_END)==-1) {
+    fclose((L1_this->f));
+    (L1_this->f) = NULL;      
+    run_time_error("file I/O error");
+  }
+  size_t len = ftell((L1_this->f));
+  rewind((L1_this->f));
+
+  if (len>PTRDIFF_MAX)
+    run_time_error("file too big for scanning");
+
+  (L1_this->base) = mmap(0, len, PROT_READ, MAP_SHARED, fileno((L1_this->f)), 0);
+  if ((L1_this->base)==MAP_FAILED) {
+    (L1_srg)->data = NULL;
+    run_time_error("error when mmapping file");
+
+  } else {
+    (L1_srg)->size = len;
+    (L1_srg)->kind = STS_MMAP;
+    (L1_srg)->isreadonly = true;
+    (L1_srg)->data = (L1_this->base);
+  }
+TRACE_POP("C__mmap_storage_C_LinesSIterator");
+MM_EXIT; return 0;
+}
+}
+
+/*
+ * METHOD FUNCTION Lines*Iterator (class Lines*Iterator)
+ */
+extern_c bool C_LinesSIterator_C_LinesSIterator(struct CClass_LinesSIterator * L1_this,char* L1_filename)
+{
+TRACE_PUSH("C_LinesSIterator_C_LinesSIterator"); MM_ENTER;
+{
+index_t *L1_0_array = new_empty_index(1);
+storage_t *L1_0_srg = new_storage(ST_UCHAR);
+(L1_this)->Vtbl->M_iterator((struct CClass_iterator *)(L1_this));
+(L1_0_array)->st = L1_0_srg;
+Midx_init_dim1(L1_0_array, 0);
+RTERR_DIM(L1_0_array->dim[0]<0);
+Midx_maclear(L1_0_array, unsigned char );
+L1_this->next_item = L1_0_array;
+L1_this->n = 0;
+(L1_this)->Vtbl->M__mmap_storage(L1_this, L1_filename, ((L1_this->next_item)->st));
+TRACE_POP("C_LinesSIterator_C_LinesSIterator");
+MM_EXIT; return 0;
+}
+}
+
+/*
+ * METHOD FUNCTION -destructor (class Lines*Iterator)
+ */
+extern_c bool C__destructor_C_LinesSIterator(struct CClass_LinesSIterator * L1_this)
+{
+TRACE_PUSH("C__destructor_C_LinesSIterator"); MM_ENTER;
+{
+ 
+  if ((L1_this->f)) {
+    if (fseek((L1_this->f),0,SEEK_END)==-1)
+      fprintf(stderr, "file I/O error in destructor");
+    else {
+      size_t len = ftell((L1_this->f));
+      munmap((L1_this->base), len);
+      fclose((L1_this->f)); 
+    }
+  }
+TRACE_POP("C__destructor_C_LinesSIterator");
+MM_EXIT; return 0;
+}
+}
+
+/*
+ * CLASS Lines*Iterator DESTROY
+ */
+static void Cdestroy_C_LinesSIterator(struct CClass_LinesSIterator *g)
+
+{
+assert(g->Vtbl);
+struct VClass_object *super = (struct VClass_object *)(void *)(&Vt_iterator);
+C__destructor_C_LinesSIterator((struct CClass_LinesSIterator*)g);
+super->Cdestroy((struct CClass_object *)g);
+g->Vtbl = NULL;
+}
+
+/*
+ * METHOD FUNCTION __mark (class LinesSIterator)
+ */
+static void C__mark_C_LinesSIterator(struct CClass_LinesSIterator *obj)
+
+{
+
+
+
+
+   MM_MARK(obj->next_item);
+}
+
+/*
+ * CLASS Lines*Iterator VTABLE
+ */
+struct VClass_LinesSIterator Vt_LinesSIterator = {
+(void*)&Vt_iterator,
+&Cdestroy_C_LinesSIterator,
+&C__mark_C_LinesSIterator,
+&C_iterator_C_iterator,
+&C__iterate_C_LinesSIterator,
+&C__make_next_C_LinesSIterator,
+&C__emptyp_C_LinesSIterator,
+&C_peeknext_C_LinesSIterator,
+&C_next_C_LinesSIterator,
+&C__mmap_storage_C_LinesSIterator,
+&C_LinesSIterator_C_LinesSIterator,
+&C__destructor_C_LinesSIterator,
+};
+
+/* ---------------------------------------- */
+
+#ifndef NOLISP
+
+/* Declarations */
+extern_c dhclassdoc_t Kc_iterator_R8c846d6e;
+extern_c dhclassdoc_t Kc_RangeIterator_Raba726ce;
+extern_c dhclassdoc_t Kc_RangeSIterator_R44dd6b29;
+extern_c dhclassdoc_t Kc_FibonacciIterator_R4cb33815;
+extern_c dhclassdoc_t Kc_RangeShuffledIterator_Re6fdc435;
+extern_c dhclassdoc_t Kc_LinesSIterator_R1d3fbaac;
+
+
+/*
+ * METHOD STUB -iterate (class RangeIterator)
+ */
+DH(X__iterate_C_RangeIterator)
+{
+dharg ret;
+ret.dh_obj_ptr = (struct CClass_object *) C__iterate_C_RangeIterator((struct CClass_RangeIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -iterate (class RangeIterator)
+ */
+DHDOC(K__iterate_C_RangeIterator_R59efa536,X__iterate_C_RangeIterator,"C__iterate_C_RangeIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_RangeIterator_Raba726ce),
+DH_RETURN,
+DH_OBJ(Kc_RangeIterator_Raba726ce),
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB -make-next (class RangeIterator)
+ */
+DH(X__make_next_C_RangeIterator)
+{
+dharg ret;
+ret.dh_bool =  C__make_next_C_RangeIterator((struct CClass_RangeIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -make-next (class RangeIterator)
+ */
+DHDOC(K__make_next_C_RangeIterator_Rf3df4769,X__make_next_C_RangeIterator,"C__make_next_C_RangeIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_RangeIterator_Raba726ce),
+DH_RETURN,
+DH_NIL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB -emptyp (class RangeIterator)
+ */
+DH(X__emptyp_C_RangeIterator)
+{
+dharg ret;
+ret.dh_bool =  C__emptyp_C_RangeIterator((struct CClass_RangeIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -emptyp (class RangeIterator)
+ */
+DHDOC(K__emptyp_C_RangeIterator_Rf3df4769,X__emptyp_C_RangeIterator,"C__emptyp_C_RangeIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_RangeIterator_Raba726ce),
+DH_RETURN,
+DH_BOOL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB peeknext (class RangeIterator)
+ */
+DH(X_peeknext_C_RangeIterator)
+{
+dharg ret;
+ret.dh_int =  C_peeknext_C_RangeIterator((struct CClass_RangeIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC peeknext (class RangeIterator)
+ */
+DHDOC(K_peeknext_C_RangeIterator_R596f6188,X_peeknext_C_RangeIterator,"C_peeknext_C_RangeIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_RangeIterator_Raba726ce),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB next (class RangeIterator)
+ */
+DH(X_next_C_RangeIterator)
+{
+dharg ret;
+ret.dh_int =  C_next_C_RangeIterator((struct CClass_RangeIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC next (class RangeIterator)
+ */
+DHDOC(K_next_C_RangeIterator_R596f6188,X_next_C_RangeIterator,"C_next_C_RangeIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_RangeIterator_Raba726ce),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB RangeIterator (class RangeIterator)
+ */
+DH(X_RangeIterator_C_RangeIterator)
+{
+dharg ret;
+ret.dh_int =  C_RangeIterator_C_RangeIterator((struct CClass_RangeIterator *)a[1].dh_obj_ptr, a[2].dh_int, a[3].dh_int, a[4].dh_int);
+return ret;
+}
+
+/*
+ * METHOD DHDOC RangeIterator (class RangeIterator)
+ */
+DHDOC(K_RangeIterator_C_RangeIterator_R45677b6f,X_RangeIterator_C_RangeIterator,"C_RangeIterator_C_RangeIterator",0,0) = {
+DH_FUNC(4),
+DH_OBJ(Kc_RangeIterator_Raba726ce),
+DH_INT,
+DH_INT,
+DH_INT,
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * CLASS RangeIterator DHCLASSDOC
+ */
+DHCLASSDOC(Kc_RangeIterator_Raba726ce, &Kc_iterator_R8c846d6e, RangeIterator, "RangeIterator", Vt_RangeIterator, 6) =
+{
+DH_CLASS(3, Kc_RangeIterator_Raba726ce),
+DH_NAME("next-item",RangeIterator,next_item),
+DH_INT,
+DH_NAME("to",RangeIterator,to),
+DH_INT,
+DH_NAME("step",RangeIterator,step),
+DH_INT,
+DH_END_CLASS,
+DH_METHOD("_iterate",K__iterate_C_RangeIterator_R59efa536),
+DH_METHOD("_make_next",K__make_next_C_RangeIterator_Rf3df4769),
+DH_METHOD("_emptyp",K__emptyp_C_RangeIterator_Rf3df4769),
+DH_METHOD("peeknext",K_peeknext_C_RangeIterator_R596f6188),
+DH_METHOD("next",K_next_C_RangeIterator_R596f6188),
+DH_METHOD("RangeIterator",K_RangeIterator_C_RangeIterator_R45677b6f),
+DH_NIL
+};
+
+/*
+ * METHOD STUB Range*Iterator (class Range*Iterator)
+ */
+DH(X_RangeSIterator_C_RangeSIterator)
+{
+dharg ret;
+ret.dh_int =  C_RangeSIterator_C_RangeSIterator((struct CClass_RangeSIterator *)a[1].dh_obj_ptr, a[2].dh_int, a[3].dh_int, a[4].dh_int);
+return ret;
+}
+
+/*
+ * METHOD DHDOC Range*Iterator (class Range*Iterator)
+ */
+DHDOC(K_RangeSIterator_C_RangeSIterator_R45677b6f,X_RangeSIterator_C_RangeSIterator,"C_RangeSIterator_C_RangeSIterator",0,0) = {
+DH_FUNC(4),
+DH_OBJ(Kc_RangeSIterator_R44dd6b29),
+DH_INT,
+DH_INT,
+DH_INT,
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB -make-next (class Range*Iterator)
+ */
+DH(X__make_next_C_RangeSIterator)
+{
+dharg ret;
+ret.dh_bool =  C__make_next_C_RangeSIterator((struct CClass_RangeSIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -make-next (class Range*Iterator)
+ */
+DHDOC(K__make_next_C_RangeSIterator_Rf3df4769,X__make_next_C_RangeSIterator,"C__make_next_C_RangeSIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_RangeSIterator_R44dd6b29),
+DH_RETURN,
+DH_NIL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * CLASS Range*Iterator DHCLASSDOC
+ */
+DHCLASSDOC(Kc_RangeSIterator_R44dd6b29, &Kc_RangeIterator_Raba726ce, RangeSIterator, "Range*Iterator", Vt_RangeSIterator, 2) =
+{
+DH_CLASS(0, Kc_RangeSIterator_R44dd6b29),
+DH_END_CLASS,
+DH_METHOD("RangeSIterator",K_RangeSIterator_C_RangeSIterator_R45677b6f),
+DH_METHOD("_make_next",K__make_next_C_RangeSIterator_Rf3df4769),
+DH_NIL
+};
+
+/*
+ * METHOD STUB -iterate (class FibonacciIterator)
+ */
+DH(X__iterate_C_FibonacciIterator)
+{
+dharg ret;
+ret.dh_obj_ptr = (struct CClass_object *) C__iterate_C_FibonacciIterator((struct CClass_FibonacciIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -iterate (class FibonacciIterator)
+ */
+DHDOC(K__iterate_C_FibonacciIterator_R59efa536,X__iterate_C_FibonacciIterator,"C__iterate_C_FibonacciIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_FibonacciIterator_R4cb33815),
+DH_RETURN,
+DH_OBJ(Kc_FibonacciIterator_R4cb33815),
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB -make-next (class FibonacciIterator)
+ */
+DH(X__make_next_C_FibonacciIterator)
+{
+dharg ret;
+ret.dh_bool =  C__make_next_C_FibonacciIterator((struct CClass_FibonacciIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -make-next (class FibonacciIterator)
+ */
+DHDOC(K__make_next_C_FibonacciIterator_Rf3df4769,X__make_next_C_FibonacciIterator,"C__make_next_C_FibonacciIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_FibonacciIterator_R4cb33815),
+DH_RETURN,
+DH_NIL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB -emptyp (class FibonacciIterator)
+ */
+DH(X__emptyp_C_FibonacciIterator)
+{
+dharg ret;
+ret.dh_bool =  C__emptyp_C_FibonacciIterator((struct CClass_FibonacciIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -emptyp (class FibonacciIterator)
+ */
+DHDOC(K__emptyp_C_FibonacciIterator_Rf3df4769,X__emptyp_C_FibonacciIterator,"C__emptyp_C_FibonacciIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_FibonacciIterator_R4cb33815),
+DH_RETURN,
+DH_BOOL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB peeknext (class FibonacciIterator)
+ */
+DH(X_peeknext_C_FibonacciIterator)
+{
+dharg ret;
+ret.dh_int =  C_peeknext_C_FibonacciIterator((struct CClass_FibonacciIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC peeknext (class FibonacciIterator)
+ */
+DHDOC(K_peeknext_C_FibonacciIterator_R596f6188,X_peeknext_C_FibonacciIterator,"C_peeknext_C_FibonacciIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_FibonacciIterator_R4cb33815),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB next (class FibonacciIterator)
+ */
+DH(X_next_C_FibonacciIterator)
+{
+dharg ret;
+ret.dh_int =  C_next_C_FibonacciIterator((struct CClass_FibonacciIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC next (class FibonacciIterator)
+ */
+DHDOC(K_next_C_FibonacciIterator_R596f6188,X_next_C_FibonacciIterator,"C_next_C_FibonacciIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_FibonacciIterator_R4cb33815),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB FibonacciIterator (class FibonacciIterator)
+ */
+DH(X_FibonacciIterator_C_FibonacciIterator)
+{
+dharg ret;
+ret.dh_bool =  C_FibonacciIterator_C_FibonacciIterator((struct CClass_FibonacciIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC FibonacciIterator (class FibonacciIterator)
+ */
+DHDOC(K_FibonacciIterator_C_FibonacciIterator_Rf3df4769,X_FibonacciIterator_C_FibonacciIterator,"C_FibonacciIterator_C_FibonacciIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_FibonacciIterator_R4cb33815),
+DH_RETURN,
+DH_BOOL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * CLASS FibonacciIterator DHCLASSDOC
+ */
+DHCLASSDOC(Kc_FibonacciIterator_R4cb33815, &Kc_iterator_R8c846d6e, FibonacciIterator, "FibonacciIterator", Vt_FibonacciIterator, 6) =
+{
+DH_CLASS(2, Kc_FibonacciIterator_R4cb33815),
+DH_NAME("f",FibonacciIterator,f),
+DH_INT,
+DH_NAME("next-item",FibonacciIterator,next_item),
+DH_INT,
+DH_END_CLASS,
+DH_METHOD("_iterate",K__iterate_C_FibonacciIterator_R59efa536),
+DH_METHOD("_make_next",K__make_next_C_FibonacciIterator_Rf3df4769),
+DH_METHOD("_emptyp",K__emptyp_C_FibonacciIterator_Rf3df4769),
+DH_METHOD("peeknext",K_peeknext_C_FibonacciIterator_R596f6188),
+DH_METHOD("next",K_next_C_FibonacciIterator_R596f6188),
+DH_METHOD("FibonacciIterator",K_FibonacciIterator_C_FibonacciIterator_Rf3df4769),
+DH_NIL
+};
+
+/*
+ * METHOD STUB -iterate (class RangeShuffledIterator)
+ */
+DH(X__iterate_C_RangeShuffledIterator)
+{
+dharg ret;
+ret.dh_obj_ptr = (struct CClass_object *) C__iterate_C_RangeShuffledIterator((struct CClass_RangeShuffledIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -iterate (class RangeShuffledIterator)
+ */
+DHDOC(K__iterate_C_RangeShuffledIterator_R59efa536,X__iterate_C_RangeShuffledIterator,"C__iterate_C_RangeShuffledIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_RangeShuffledIterator_Re6fdc435),
+DH_RETURN,
+DH_OBJ(Kc_RangeShuffledIterator_Re6fdc435),
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB -make-next (class RangeShuffledIterator)
+ */
+DH(X__make_next_C_RangeShuffledIterator)
+{
+dharg ret;
+ret.dh_bool =  C__make_next_C_RangeShuffledIterator((struct CClass_RangeShuffledIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -make-next (class RangeShuffledIterator)
+ */
+DHDOC(K__make_next_C_RangeShuffledIterator_Rf3df4769,X__make_next_C_RangeShuffledIterator,"C__make_next_C_RangeShuffledIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_RangeShuffledIterator_Re6fdc435),
+DH_RETURN,
+DH_NIL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB -emptyp (class RangeShuffledIterator)
+ */
+DH(X__emptyp_C_RangeShuffledIterator)
+{
+dharg ret;
+ret.dh_bool =  C__emptyp_C_RangeShuffledIterator((struct CClass_RangeShuffledIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -emptyp (class RangeShuffledIterator)
+ */
+DHDOC(K__emptyp_C_RangeShuffledIterator_Rf3df4769,X__emptyp_C_RangeShuffledIterator,"C__emptyp_C_RangeShuffledIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_RangeShuffledIterator_Re6fdc435),
+DH_RETURN,
+DH_BOOL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB peeknext (class RangeShuffledIterator)
+ */
+DH(X_peeknext_C_RangeShuffledIterator)
+{
+dharg ret;
+ret.dh_int =  C_peeknext_C_RangeShuffledIterator((struct CClass_RangeShuffledIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC peeknext (class RangeShuffledIterator)
+ */
+DHDOC(K_peeknext_C_RangeShuffledIterator_R596f6188,X_peeknext_C_RangeShuffledIterator,"C_peeknext_C_RangeShuffledIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_RangeShuffledIterator_Re6fdc435),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB next (class RangeShuffledIterator)
+ */
+DH(X_next_C_RangeShuffledIterator)
+{
+dharg ret;
+ret.dh_int =  C_next_C_RangeShuffledIterator((struct CClass_RangeShuffledIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC next (class RangeShuffledIterator)
+ */
+DHDOC(K_next_C_RangeShuffledIterator_R596f6188,X_next_C_RangeShuffledIterator,"C_next_C_RangeShuffledIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_RangeShuffledIterator_Re6fdc435),
+DH_RETURN,
+DH_INT,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB RangeShuffledIterator (class RangeShuffledIterator)
+ */
+DH(X_RangeShuffledIterator_C_RangeShuffledIterator)
+{
+dharg ret;
+ret.dh_bool =  C_RangeShuffledIterator_C_RangeShuffledIterator((struct CClass_RangeShuffledIterator *)a[1].dh_obj_ptr, a[2].dh_int, a[3].dh_int);
+return ret;
+}
+
+/*
+ * METHOD DHDOC RangeShuffledIterator (class RangeShuffledIterator)
+ */
+DHDOC(K_RangeShuffledIterator_C_RangeShuffledIterator_R24b748bc,X_RangeShuffledIterator_C_RangeShuffledIterator,"C_RangeShuffledIterator_C_RangeShuffledIterator",0,0) = {
+DH_FUNC(3),
+DH_OBJ(Kc_RangeShuffledIterator_Re6fdc435),
+DH_INT,
+DH_INT,
+DH_RETURN,
+DH_NIL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * CLASS RangeShuffledIterator DHCLASSDOC
+ */
+DHCLASSDOC(Kc_RangeShuffledIterator_Re6fdc435, &Kc_iterator_R8c846d6e, RangeShuffledIterator, "RangeShuffledIterator", Vt_RangeShuffledIterator, 6) =
+{
+DH_CLASS(8, Kc_RangeShuffledIterator_Re6fdc435),
+DH_NAME("next-item",RangeShuffledIterator,next_item),
+DH_INT,
+DH_NAME("from",RangeShuffledIterator,from),
+DH_INT,
+DH_NAME("to",RangeShuffledIterator,to),
+DH_INT,
+DH_NAME("x",RangeShuffledIterator,x),
+DH_INT,
+DH_NAME("N",RangeShuffledIterator,N),
+DH_INT,
+DH_NAME("A",RangeShuffledIterator,A),
+DH_INT,
+DH_NAME("B",RangeShuffledIterator,B),
+DH_INT,
+DH_NAME("count",RangeShuffledIterator,count),
+DH_INT,
+DH_END_CLASS,
+DH_METHOD("_iterate",K__iterate_C_RangeShuffledIterator_R59efa536),
+DH_METHOD("_make_next",K__make_next_C_RangeShuffledIterator_Rf3df4769),
+DH_METHOD("_emptyp",K__emptyp_C_RangeShuffledIterator_Rf3df4769),
+DH_METHOD("peeknext",K_peeknext_C_RangeShuffledIterator_R596f6188),
+DH_METHOD("next",K_next_C_RangeShuffledIterator_R596f6188),
+DH_METHOD("RangeShuffledIterator",K_RangeShuffledIterator_C_RangeShuffledIterator_R24b748bc),
+DH_NIL
+};
+
+/*
+ * METHOD STUB -iterate (class Lines*Iterator)
+ */
+DH(X__iterate_C_LinesSIterator)
+{
+dharg ret;
+ret.dh_obj_ptr = (struct CClass_object *) C__iterate_C_LinesSIterator((struct CClass_LinesSIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -iterate (class Lines*Iterator)
+ */
+DHDOC(K__iterate_C_LinesSIterator_R59efa536,X__iterate_C_LinesSIterator,"C__iterate_C_LinesSIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_LinesSIterator_R1d3fbaac),
+DH_RETURN,
+DH_OBJ(Kc_LinesSIterator_R1d3fbaac),
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB -make-next (class Lines*Iterator)
+ */
+DH(X__make_next_C_LinesSIterator)
+{
+dharg ret;
+ret.dh_bool =  C__make_next_C_LinesSIterator((struct CClass_LinesSIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -make-next (class Lines*Iterator)
+ */
+DHDOC(K__make_next_C_LinesSIterator_Rf3df4769,X__make_next_C_LinesSIterator,"C__make_next_C_LinesSIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_LinesSIterator_R1d3fbaac),
+DH_RETURN,
+DH_NIL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB -emptyp (class Lines*Iterator)
+ */
+DH(X__emptyp_C_LinesSIterator)
+{
+dharg ret;
+ret.dh_bool =  C__emptyp_C_LinesSIterator((struct CClass_LinesSIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -emptyp (class Lines*Iterator)
+ */
+DHDOC(K__emptyp_C_LinesSIterator_Rf3df4769,X__emptyp_C_LinesSIterator,"C__emptyp_C_LinesSIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_LinesSIterator_R1d3fbaac),
+DH_RETURN,
+DH_BOOL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB peeknext (class Lines*Iterator)
+ */
+DH(X_peeknext_C_LinesSIterator)
+{
+dharg ret;
+ret.dh_idx_ptr =  C_peeknext_C_LinesSIterator((struct CClass_LinesSIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC peeknext (class Lines*Iterator)
+ */
+DHDOC(K_peeknext_C_LinesSIterator_R59efa536,X_peeknext_C_LinesSIterator,"C_peeknext_C_LinesSIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_LinesSIterator_R1d3fbaac),
+DH_RETURN,
+DH_IDX(DHT_READ,1),
+DH_SRG(DHT_READ),
+DH_UCHAR,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB next (class Lines*Iterator)
+ */
+DH(X_next_C_LinesSIterator)
+{
+dharg ret;
+ret.dh_idx_ptr =  C_next_C_LinesSIterator((struct CClass_LinesSIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC next (class Lines*Iterator)
+ */
+DHDOC(K_next_C_LinesSIterator_R59efa536,X_next_C_LinesSIterator,"C_next_C_LinesSIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_LinesSIterator_R1d3fbaac),
+DH_RETURN,
+DH_IDX(DHT_READ,1),
+DH_SRG(DHT_READ),
+DH_UCHAR,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB -mmap-storage (class Lines*Iterator)
+ */
+DH(X__mmap_storage_C_LinesSIterator)
+{
+dharg ret;
+ret.dh_bool =  C__mmap_storage_C_LinesSIterator((struct CClass_LinesSIterator *)a[1].dh_obj_ptr, a[2].dh_str_ptr, a[3].dh_srg_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -mmap-storage (class Lines*Iterator)
+ */
+DHDOC(K__mmap_storage_C_LinesSIterator_R293d26ac,X__mmap_storage_C_LinesSIterator,"C__mmap_storage_C_LinesSIterator",0,0) = {
+DH_FUNC(3),
+DH_OBJ(Kc_LinesSIterator_R1d3fbaac),
+DH_STR,
+DH_SRG(DHT_READ),
+DH_UCHAR,
+DH_RETURN,
+DH_NIL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB Lines*Iterator (class Lines*Iterator)
+ */
+DH(X_LinesSIterator_C_LinesSIterator)
+{
+dharg ret;
+ret.dh_bool =  C_LinesSIterator_C_LinesSIterator((struct CClass_LinesSIterator *)a[1].dh_obj_ptr, a[2].dh_str_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC Lines*Iterator (class Lines*Iterator)
+ */
+DHDOC(K_LinesSIterator_C_LinesSIterator_R45c167d5,X_LinesSIterator_C_LinesSIterator,"C_LinesSIterator_C_LinesSIterator",0,0) = {
+DH_FUNC(2),
+DH_OBJ(Kc_LinesSIterator_R1d3fbaac),
+DH_STR,
+DH_RETURN,
+DH_NIL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * METHOD STUB -destructor (class Lines*Iterator)
+ */
+DH(X__destructor_C_LinesSIterator)
+{
+dharg ret;
+ret.dh_bool =  C__destructor_C_LinesSIterator((struct CClass_LinesSIterator *)a[1].dh_obj_ptr);
+return ret;
+}
+
+/*
+ * METHOD DHDOC -destructor (class Lines*Iterator)
+ */
+DHDOC(K__destructor_C_LinesSIterator_Rf3df4769,X__destructor_C_LinesSIterator,"C__destructor_C_LinesSIterator",0,0) = {
+DH_FUNC(1),
+DH_OBJ(Kc_LinesSIterator_R1d3fbaac),
+DH_RETURN,
+DH_NIL,
+DH_END_FUNC,
+DH_NIL
+};
+
+/*
+ * CLASS Lines*Iterator DHCLASSDOC
+ */
+DHCLASSDOC(Kc_LinesSIterator_R1d3fbaac, &Kc_iterator_R8c846d6e, LinesSIterator, "Lines*Iterator", Vt_LinesSIterator, 8) =
+{
+DH_CLASS(4, Kc_LinesSIterator_R1d3fbaac),
+DH_NAME("f",LinesSIterator,f),
+DH_GPTR("FILE *"),
+DH_NAME("base",LinesSIterator,base),
+DH_GPTR("char *"),
+DH_NAME("n",LinesSIterator,n),
+DH_INT,
+DH_NAME("next-item",LinesSIterator,next_item),
+DH_IDX(DHT_READ,1),
+DH_SRG(DHT_READ),
+DH_UCHAR,
+DH_END_CLASS,
+DH_METHOD("_iterate",K__iterate_C_LinesSIterator_R59efa536),
+DH_METHOD("_make_next",K__make_next_C_LinesSIterator_Rf3df4769),
+DH_METHOD("_emptyp",K__emptyp_C_LinesSIterator_Rf3df4769),
+DH_METHOD("peeknext",K_peeknext_C_LinesSIterator_R59efa536),
+DH_METHOD("next",K_next_C_LinesSIterator_R59efa536),
+DH_METHOD("_mmap_storage",K__mmap_storage_C_LinesSIterator_R293d26ac),
+DH_METHOD("LinesSIterator",K_LinesSIterator_C_LinesSIterator_R45c167d5),
+DH_METHOD("_destructor",K__destructor_C_LinesSIterator_Rf3df4769),
+DH_NIL
+};
+
+/*
+ * INIT FUNCTION
+ */
+extern_c void init_iterator_classes(void)
+{
+ dhclass_define("RangeIterator", &Kc_RangeIterator_Raba726ce);
+ dhmethod_define(&Kc_RangeIterator_Raba726ce, "-iterate", &K__iterate_C_RangeIterator_R59efa536);
+ dhmethod_define(&Kc_RangeIterator_Raba726ce, "-make-next", &K__make_next_C_RangeIterator_Rf3df4769);
+ dhmethod_define(&Kc_RangeIterator_Raba726ce, "-emptyp", &K__emptyp_C_RangeIterator_Rf3df4769);
+ dhmethod_define(&Kc_RangeIterator_Raba726ce, "peeknext", &K_peeknext_C_RangeIterator_R596f6188);
+ dhmethod_define(&Kc_RangeIterator_Raba726ce, "next", &K_next_C_RangeIterator_R596f6188);
+ dhmethod_define(&Kc_RangeIterator_Raba726ce, "RangeIterator", &K_RangeIterator_C_RangeIterator_R45677b6f);
+ dhclass_define("Range*Iterator", &Kc_RangeSIterator_R44dd6b29);
+ dhmethod_define(&Kc_RangeSIterator_R44dd6b29, "Range*Iterator", &K_RangeSIterator_C_RangeSIterator_R45677b6f);
+ dhmethod_define(&Kc_RangeSIterator_R44dd6b29, "-make-next", &K__make_next_C_RangeSIterator_Rf3df4769);
+ dhclass_define("FibonacciIterator", &Kc_FibonacciIterator_R4cb33815);
+ dhmethod_define(&Kc_FibonacciIterator_R4cb33815, "-iterate", &K__iterate_C_FibonacciIterator_R59efa536);
+ dhmethod_define(&Kc_FibonacciIterator_R4cb33815, "-make-next", &K__make_next_C_FibonacciIterator_Rf3df4769);
+ dhmethod_define(&Kc_FibonacciIterator_R4cb33815, "-emptyp", &K__emptyp_C_FibonacciIterator_Rf3df4769);
+ dhmethod_define(&Kc_FibonacciIterator_R4cb33815, "peeknext", &K_peeknext_C_FibonacciIterator_R596f6188);
+ dhmethod_define(&Kc_FibonacciIterator_R4cb33815, "next", &K_next_C_FibonacciIterator_R596f6188);
+ dhmethod_define(&Kc_FibonacciIterator_R4cb33815, "FibonacciIterator", &K_FibonacciIterator_C_FibonacciIterator_Rf3df4769);
+ dhclass_define("RangeShuffledIterator", &Kc_RangeShuffledIterator_Re6fdc435);
+ dhmethod_define(&Kc_RangeShuffledIterator_Re6fdc435, "-iterate", &K__iterate_C_RangeShuffledIterator_R59efa536);
+ dhmethod_define(&Kc_RangeShuffledIterator_Re6fdc435, "-make-next", &K__make_next_C_RangeShuffledIterator_Rf3df4769);
+ dhmethod_define(&Kc_RangeShuffledIterator_Re6fdc435, "-emptyp", &K__emptyp_C_RangeShuffledIterator_Rf3df4769);
+ dhmethod_define(&Kc_RangeShuffledIterator_Re6fdc435, "peeknext", &K_peeknext_C_RangeShuffledIterator_R596f6188);
+ dhmethod_define(&Kc_RangeShuffledIterator_Re6fdc435, "next", &K_next_C_RangeShuffledIterator_R596f6188);
+ dhmethod_define(&Kc_RangeShuffledIterator_Re6fdc435, "RangeShuffledIterator", &K_RangeShuffledIterator_C_RangeShuffledIterator_R24b748bc);
+ dhclass_define("Lines*Iterator", &Kc_LinesSIterator_R1d3fbaac);
+ dhmethod_define(&Kc_LinesSIterator_R1d3fbaac, "-iterate", &K__iterate_C_LinesSIterator_R59efa536);
+ dhmethod_define(&Kc_LinesSIterator_R1d3fbaac, "-make-next", &K__make_next_C_LinesSIterator_Rf3df4769);
+ dhmethod_define(&Kc_LinesSIterator_R1d3fbaac, "-emptyp", &K__emptyp_C_LinesSIterator_Rf3df4769);
+ dhmethod_define(&Kc_LinesSIterator_R1d3fbaac, "peeknext", &K_peeknext_C_LinesSIterator_R59efa536);
+ dhmethod_define(&Kc_LinesSIterator_R1d3fbaac, "next", &K_next_C_LinesSIterator_R59efa536);
+ dhmethod_define(&Kc_LinesSIterator_R1d3fbaac, "-mmap-storage", &K__mmap_storage_C_LinesSIterator_R293d26ac);
+ dhmethod_define(&Kc_LinesSIterator_R1d3fbaac, "Lines*Iterator", &K_LinesSIterator_C_LinesSIterator_R45c167d5);
+ dhmethod_define(&Kc_LinesSIterator_R1d3fbaac, "-destructor", &K__destructor_C_LinesSIterator_Rf3df4769);
+}
+
+int majver_iterator_classes = 50;
+int minver_iterator_classes = 01;
+
+
+#endif
+
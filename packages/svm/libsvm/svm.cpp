@@ -78,6 +78,13 @@
 #include <string.h>
 #include <stdarg.h>
 
+#ifdef HAVE_CONFIG_H
+# include "lushconf.h"
+#endif
+#if HAVE_PTHREAD
+# include <pthread.h>
+#endif
+
 #include "svm.h"
 
 
@@ -106,6 +113,9 @@ template <class S, class T> inline void clone(T*& dst, S* src, int n)
 #define Realloc(type,p,n) (type *)xrealloc((void*)p, (n)*sizeof(type))
 
 extern "C" void lush_error(const char *s);
+#if HAVE_PTHREAD
+extern "C" int start_worker(pthread_t *t, void *(*f)(void *), void *arg);
+#endif
 
 void *xmalloc(int n) 
 {
@@ -290,14 +300,73 @@ protected:
 
 	// svm_parameter
 	double (*kernel_function) ( const svm_node *x, const svm_node *y);
+	int nr_threads;
+
+	// fill data[start,len) with K(x[i],x[j])
+	void get_column(int i, int start, int len, Qfloat *data) const;
 };
 
 Kernel::Kernel(int l, svm_node * const * x_, const svm_parameter& param)
-:kernel_function(param.kernel_function)
+:kernel_function(param.kernel_function),nr_threads(param.nr_threads)
 {
 	clone(x,x_,l);
 }
 
+//
+// Kernel columns are split among nr_threads threads
+// when they are long enough to pay for the thread startup.
+//
+#define MAX_THREADS 64
+#define MIN_THREAD_COLUMN 256
+
+struct column_job
+{
+	double (*kernel_function) ( const svm_node *x, const svm_node *y);
+	const svm_node *xi;
+	const svm_node * const *x;
+	Qfloat *data;
+	int start, end;
+};
+
+static void *column_job_run(void *arg)
+{
+	column_job *job = (column_job *)arg;
+	for(int j=job->start;j<job->end;j++)
+		job->data[j] = (Qfloat)(*job->kernel_function)(job->xi,job->x[j]);
+	return 0;
+}
+
+void Kernel::get_column(int i, int start, int len, Qfloat *data) const
+{
+	int nt = min(min(nr_threads,(int)MAX_THREADS),(len-start)/MIN_THREAD_COLUMN);
+	if(nt < 1) nt = 1;
+	column_job jobs[MAX_THREADS];
+	for(int t=0;t<nt;t++)
+	{
+		jobs[t].kernel_function = kernel_function;
+		jobs[t].xi = x[i];
+		jobs[t].x = x;
+		jobs[t].data = data;
+		jobs[t].start = start + (int)((long)(len-start)*t/nt);
+		jobs[t].end = start + (int)((long)(len-start)*(t+1)/nt);
+	}
+#if HAVE_PTHREAD
+	pthread_t threads[MAX_THREADS];
+	bool started[MAX_THREADS];
+	for(int t=1;t<nt;t++)
+		started[t] = !start_worker(&threads[t],column_job_run,&jobs[t]);
+	column_job_run(&jobs[0]);
+	for(int t=1;t<nt;t++)
+		if(started[t])
+			pthread_join(threads[t],0);
+		else
+			column_job_run(&jobs[t]);
+#else
+	for(int t=0;t<nt;t++)
+		column_job_run(&jobs[t]);
+#endif
+}
+
 Kernel::~Kernel()
 {
 	delete[] x;
@@ -1100,8 +1169,10 @@ public:
 		int start;
 		if((start = cache->get_data(i,&data,len)) < len)
 		{
+			get_column(i,start,len,data);
 			for(int j=start;j<len;j++)
-				data[j] = (Qfloat)(y[i]*y[j]*(*kernel_function)(x[i],x[j]));
+				if(y[i]!=y[j])
+					data[j] = -data[j];
 		}
 		return data;
 	}
@@ -1137,10 +1208,7 @@ public:
 		Qfloat *data;
 		int start;
 		if((start = cache->get_data(i,&data,len)) < len)
-		{
-			for(int j=start;j<len;j++)
-				data[j] = (Qfloat)(*kernel_function)(x[i],x[j]);
-		}
+			get_column(i,start,len,data);
 		return data;
 	}
 
@@ -1191,10 +1259,7 @@ public:
 		Qfloat *data;
 		int real_i = index[i];
 		if(cache->get_data(real_i,&data,l) < l)
-		{
-			for(int j=0;j<l;j++)
-				data[j] = (Qfloat)(*kernel_function)(x[real_i],x[j]);
-		}
+			get_column(real_i,0,l,data);
 
 		// reorder and copy
 		Qfloat *buf = buffer[next_buffer];
@@ -1874,6 +1939,9 @@ const char *svm_check_parameter(const svm_problem *prob, const svm_parameter *pa
 	if(param->cache_size <= 0)
 		return "cache_size <= 0";
 
+	if(param->nr_threads < 1)
+		return "nr_threads < 1";
+
 	if(param->eps <= 0)
 		return "eps <= 0";
 
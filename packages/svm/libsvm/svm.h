@@ -109,6 +109,7 @@ struct svm_parameter
 	double nu;	        /* for NU_SVC, ONE_CLASS, and NU_SVR */
 	double p;	        /* for EPSILON_SVR */
 	int shrinking;	        /* use the shrinking heuristics */
+	int nr_threads;	        /* threads computing kernel columns */
 };
 
 //
@@ -101,9 +101,16 @@ DX(xatom)
 
 at *new_at_number(double x)
 {
+   at *new = mm_alloc(mt_at);
+#ifdef IMMEDIATE_NUMBERS
+   Number(new) = x;
+#else
    double *d = mm_alloc(mt_blob8);
    *d = x;
-   return new_at(number_class, d);
+   Mptr(new) = d;
+#endif
+   AssignClass(new, number_class);
+   return new;
 }
 
 
@@ -296,6 +303,9 @@ void init_at(void)
    /* set up builtin classes */
    number_class = new_builtin_class(NIL);
    number_class-> name = number_name;
+#ifdef IMMEDIATE_NUMBERS
+   number_class->managed = false;
+#endif
    class_define("Number", number_class);
 
    gptr_class = new_builtin_class(NIL);
@@ -64,6 +64,7 @@ char *rterr_bad_dimensions = "arguments have the wrong dimensions";
 
 
 struct dh_trace_stack *dh_trace_root = 0;
+int dh_trace_frozen = 0;
 
 /* print_dh_recent: print n recent functions */
 
@@ -168,6 +169,11 @@ void check_main_main_maout_dot42(index_t *i0, index_t *i1, index_t *i2)
    Mcheck_main_main_maout_dot42(i0, i1, i2);
 }
 
+void check_main_main_maout_dot22(index_t *i0, index_t *i1, index_t *i2)
+{
+   Mcheck_main_main_maout_dot22(i0, i1, i2);
+}
+
 void check_m1in_m1in_m2out(index_t *i0, index_t *i1, index_t *i2)
 {
    Mcheck_m1in_m1in_m2out(i0, i1, i2);
@@ -742,10 +742,12 @@ void lush_error(const char *s)
       printf("\n\n*** lush runtime error: %s\007\007\n",s);
       print_dh_trace_stack();
       dh_trace_root = 0;
+      dh_trace_frozen = 0;
       longjmp(lush_error_jump, -1);
       
    } else {
       dh_trace_root = 0;
+      dh_trace_frozen = 0;
       error(NIL, s, NIL);
    }
 }
@@ -1136,6 +1138,7 @@ static at *dh_listeval(at *p, at *q)
 /*       fprintf(stderr, "*** Warning: reentrant call to compiled code\n"); */
    int errflag = setjmp(lush_error_jump);
    dh_trace_root = 0;
+   dh_trace_frozen = 0;
    
    /* Call compiled code */
    dharg funcret;
@@ -1151,6 +1154,7 @@ static at *dh_listeval(at *p, at *q)
    /* Prepare for the update */
    in_compiled_code = false;
    dh_trace_root = 0;
+   dh_trace_frozen = 0;
     
    /* Build return value */
    at *atfuncret = NIL;
@@ -38,6 +38,10 @@ extern void os_unblock_async_poll(void);
 extern void os_setup_async_poll(int*fds, int nfds, void(*apoll)(void));
 extern int  os_wait(int nfds, int* fds, int console, unsigned long ms);
 extern void os_curtime(int *sec, int *msec);
+extern int  os_watch_fd(int fd, int mode);
+extern int  os_poll_fds(int *fds, int *modes, int maxfds);
+extern bool os_fd_closed(int fd);
+extern bool os_file_pending(FILE *f);
 
 
 /* ------------------------------------ */
@@ -196,24 +200,28 @@ typedef struct evtime {
    int msec;
 } evtime_t;
 
+/* Pending timers are kept in a binary heap ordered by date.
+ * Each timer remembers its position in the heap.
+ */
+
 typedef struct event_timer {
-   struct event_timer *next;
+   int index;
    evtime_t date;
    evtime_t period;
    at *handler;
 } event_timer_t;
 
-static event_timer_t *timers = 0;
+static event_timer_t **timers = 0;
+static int ntimers = 0;
+static int maxtimers = 0;
 
 static void clear_event_timer(event_timer_t *et, size_t _)
 {
-   et->next = NULL;
    et->handler = NULL;
 }
 
 static void mark_event_timer(event_timer_t *et)
 {
-   MM_MARK(et->next);
    MM_MARK(et->handler);
 }
 
@@ -258,25 +266,72 @@ static void evtime_sub(evtime_t *t1, evtime_t *t2, evtime_t *r)
    }
 }
 
-static void ti_notify(at *handler, void *_)
+static void ti_place(event_timer_t *ti, int i)
 {
-  event_timer_t *et, **p = &timers;
-  while ((et = *p)) {
-     if (et->handler == handler)
-        *p = et->next;
-     else
-        p = &(et->next);
-  }
+   timers[i] = ti;
+   ti->index = i;
 }
 
-static void ti_insert(event_timer_t *ti)
+static void ti_siftup(event_timer_t *ti, int i)
 {
-   event_timer_t *et, **p;
-   for (p = &timers; (et = *p); p = &(et->next))
-      if (evtime_cmp(&ti->date, &et->date)<0)
+   while (i > 0) {
+      int p = (i-1)/2;
+      if (evtime_cmp(&timers[p]->date, &ti->date) <= 0)
+         break;
+      ti_place(timers[p], i);
+      i = p;
+   }
+   ti_place(ti, i);
+}
+
+static void ti_siftdown(event_timer_t *ti, int i)
+{
+   for (;;) {
+      int c = 2*i+1;
+      if (c >= ntimers)
+         break;
+      if (c+1 < ntimers && evtime_cmp(&timers[c+1]->date, &timers[c]->date) < 0)
+         c += 1;
+      if (evtime_cmp(&ti->date, &timers[c]->date) <= 0)
          break;
-   ti->next = et;
-   *p = ti;
+      ti_place(timers[c], i);
+      i = c;
+   }
+   ti_place(ti, i);
+}
+
+static void ti_insert(event_timer_t *ti)
+{
+   if (ntimers >= maxtimers) {
+      int n = (maxtimers) ? 2*maxtimers : 64;
+      event_timer_t **t = mm_allocv(mt_refs, n*sizeof(event_timer_t *));
+      if (ntimers)
+         memcpy(t, timers, ntimers*sizeof(event_timer_t *));
+      memset(t+ntimers, 0, (n-ntimers)*sizeof(event_timer_t *));
+      timers = t;
+      maxtimers = n;
+   }
+   ti_siftup(ti, ntimers++);
+}
+
+static void ti_remove(int i)
+{
+   timers[i]->index = -1;
+   event_timer_t *last = timers[--ntimers];
+   timers[ntimers] = NULL;
+   if (i < ntimers) {
+      if (i > 0 && evtime_cmp(&last->date, &timers[(i-1)/2]->date) < 0)
+         ti_siftup(last, i);
+      else
+         ti_siftdown(last, i);
+   }
+}
+
+static void ti_notify(at *handler, void *_)
+{
+   for (int i=ntimers-1; i>=0; i--)
+      if (timers[i]->handler == handler)
+         ti_remove(i);
 }
 
 
@@ -291,7 +346,6 @@ static void *timer_add_sub(at *handler, int sec, int msec, int period)
       et->period.sec = period/1000;
       et->period.msec = period%1000;
       et->handler = handler;
-      et->next = 0;
       ti_insert(et);
       return et;
    }
@@ -341,12 +395,11 @@ void *timer_abs(at *handler, double date)
  */
 void timer_del(void *handle)
 {
-   event_timer_t *et, **p;
-   for (p=&timers; (et = *p); p=&(et->next))
-      if (et == handle) {
-         *p = et->next;
-         break;
-      }
+   /* The handle may refer to an expired timer:
+      check its heap slot before removing it. */
+   event_timer_t *et = handle;
+   if (et && et->index >= 0 && et->index < ntimers && timers[et->index] == et)
+      ti_remove(et->index);
 }
 
 
@@ -359,25 +412,24 @@ int timer_fire(void)
 {
    evtime_t now;
    evtime_now(&now);
-   while (timers && evtime_cmp(&now,&timers->date)>=0) {
-      event_timer_t *ti = timers;
+   while (ntimers && evtime_cmp(&now,&timers[0]->date)>=0) {
+      event_timer_t *ti = timers[0];
       at *p = new_cons(named("timer"), 
                        new_cons(NEW_GPTR(ti), NIL));
-      timers = ti->next;
       event_add(ti->handler, p);
       
       if (ti->period.sec>0 || ti->period.msec>0) {
          /* Periodic timer shoot only once per call */
          while (evtime_cmp(&now,&ti->date) >= 0)
             evtime_add(&ti->date,&ti->period,&ti->date);
-         ti_insert(ti);
-
-      }
+         ti_siftdown(ti, 0);
+      } else
+         ti_remove(0);
    }
    
-   if (timers) {
+   if (ntimers) {
       evtime_t diff;
-      evtime_sub(&timers->date, &now, &diff);
+      evtime_sub(&timers[0]->date, &now, &diff);
       if (diff.sec < 24*3600)
          return diff.sec * 1000 + diff.msec;
    }
@@ -538,6 +590,169 @@ void unblock_async_poll(void)
 }
 
 
+/* ------------------------------------ */
+/* FILE DESCRIPTORS                     */
+/* ------------------------------------ */     
+
+/* File descriptor watchers are indexed by descriptor.
+ * A watcher that fired is disarmed until the next pass
+ * over the event loop, so that the handler gets a single
+ * event for each pass even if it does not consume the data.
+ */
+
+typedef struct event_watch {
+   struct event_watch *next;    /* chain of disarmed watchers */
+   int fd;
+   int mode;                    /* 1: readable, 2: writable */
+   bool armed;
+   at *handler;
+   at *file;                    /* lisp file read through fd, or NIL */
+} event_watch_t;
+
+static event_watch_t **watches = 0;
+static event_watch_t *disarmed = 0;
+static int maxwatches = 0;
+static int nwatches = 0;
+static int nfilewatches = 0;
+static void *watch_source = 0;
+static int watch_waitfd = -1;
+
+static void clear_event_watch(event_watch_t *ew, size_t _)
+{
+   ew->next = NULL;
+   ew->handler = NULL;
+   ew->file = NULL;
+}
+
+static void mark_event_watch(event_watch_t *ew)
+{
+   MM_MARK(ew->next);
+   MM_MARK(ew->handler);
+   MM_MARK(ew->file);
+}
+
+static mt_t mt_event_watch = mt_undefined;
+
+
+static void fd_fire(event_watch_t *ew)
+{
+   int fd = ew->fd;
+   at *p = new_cons(named((ew->mode == 2) ? "fd-writable" : "fd-readable"),
+                    new_cons(NEW_NUMBER(fd), NIL));
+   event_add(ew->handler, p);
+   os_watch_fd(fd, 0);
+   ew->armed = false;
+   ew->next = disarmed;
+   disarmed = ew;
+}
+
+static int fd_spoll(void)
+{
+   int fds[64], modes[64];
+   int n = os_poll_fds(fds, modes, 64);
+   for (int i=0; i<n; i++) {
+      int fd = fds[i];
+      event_watch_t *ew = (fd < maxwatches) ? watches[fd] : 0;
+      if (ew && ew->armed)
+         fd_fire(ew);
+   }
+   /* input already buffered by stdio does not make fd readable */
+   if (nfilewatches)
+      for (int fd=0; fd<maxwatches; fd++) {
+         event_watch_t *ew = watches[fd];
+         if (ew && ew->armed && ew->file && RFILEP(ew->file) &&
+             os_file_pending((FILE *)Gptr(ew->file)))
+            fd_fire(ew);
+      }
+   /* without a descriptor to wait on, poll often */
+   return (watch_waitfd < 0) ? 20 : 0;
+}
+
+/* fd_unwatch --
+ * Stop watching file descriptor fd.
+ */
+void fd_unwatch(int fd)
+{
+   if (fd >= 0 && fd < maxwatches && watches[fd]) {
+      if (watches[fd]->armed)
+         os_watch_fd(fd, 0);
+      if (watches[fd]->file)
+         nfilewatches--;
+      watches[fd] = NULL;
+      if (! --nwatches && watch_source) {
+         unregister_poll_functions(watch_source);
+         watch_source = 0;
+      }
+   }
+}
+
+static void fd_rearm(void)
+{
+   event_watch_t *ew;
+   while ((ew = disarmed)) {
+      disarmed = ew->next;
+      ew->next = NULL;
+      if (ew->fd < maxwatches && watches[ew->fd] == ew) {
+         /* the descriptor was closed without fd_unwatch */
+         if (os_fd_closed(ew->fd)) {
+            fd_unwatch(ew->fd);
+            continue;
+         }
+         os_watch_fd(ew->fd, ew->mode);
+         ew->armed = true;
+      }
+   }
+}
+
+static void fd_notify(at *handler, void *_)
+{
+   for (int fd=0; fd<maxwatches; fd++)
+      if (watches[fd] && watches[fd]->handler == handler)
+         fd_unwatch(fd);
+}
+
+/* fd_watch --
+ * Send an event (fd-readable <fd>) or (fd-writable <fd>)
+ * to the specified handler whenever file descriptor fd
+ * becomes readable (mode 1) or writable (mode 2).
+ * When file is a lisp file reading fd, input buffered
+ * in the file also makes fd readable.
+ */
+void fd_watch(at *handler, int fd, int mode, at *file)
+{
+   if (!handler)
+      RAISEF("invalid event handler", handler);
+   if (fd < 0)
+      RAISEF("invalid file descriptor", NEW_NUMBER(fd));
+   if (fd >= maxwatches) {
+      int n = (maxwatches) ? maxwatches : 64;
+      while (n <= fd)
+         n += n;
+      event_watch_t **w = mm_allocv(mt_refs, n*sizeof(event_watch_t *));
+      if (maxwatches)
+         memcpy(w, watches, maxwatches*sizeof(event_watch_t *));
+      memset(w+maxwatches, 0, (n-maxwatches)*sizeof(event_watch_t *));
+      watches = w;
+      maxwatches = n;
+   }
+   fd_unwatch(fd);
+   add_notifier(handler, (wr_notify_func_t *)fd_notify, 0);
+   event_watch_t *ew = mm_alloc(mt_event_watch);
+   assert(ew);
+   ew->fd = fd;
+   ew->mode = mode;
+   ew->handler = handler;
+   ew->file = (mode == 1 && RFILEP(file)) ? file : NIL;
+   watch_waitfd = os_watch_fd(fd, mode);
+   ew->armed = true;
+   watches[fd] = ew;
+   if (ew->file)
+      nfilewatches++;
+   if (!nwatches++)
+      watch_source = register_poll_functions(fd_spoll, 0, 0, 0, watch_waitfd);
+}
+
+
 /* ------------------------------------ */
 /* PROCESSING EVENTS                    */
 /* ------------------------------------ */     
@@ -553,6 +768,7 @@ at *event_wait(bool console)
    int cinput = 0;
    int toggle = 1;
    block_async_poll();
+   fd_rearm();
    for (;;) {
       if ((hndl = ev_peek()))
          break;
@@ -594,6 +810,7 @@ void process_pending_events(void)
 {
    MM_ENTER;
    int timer_fired = 0;
+   fd_rearm();
    call_spoll();
    at *hndl = ev_peek();
    for(;;) {
@@ -840,6 +1057,36 @@ DX(xkill_timer)
    return NIL;
 }
 
+/* Watch a file descriptor */
+DX(xwatch_fd)
+{
+   int mode = 1;
+   if (arg_number == 3)
+      mode = (APOINTER(3)) ? 2 : 1;
+   else
+      ARG_NUMBER(2);
+   at *p = APOINTER(2);
+   int fd;
+   if (RFILEP(p) || WFILEP(p))
+      fd = fileno((FILE *)Gptr(p));
+   else
+      fd = AINTEGER(2);
+   fd_watch(APOINTER(1), fd, mode, p);
+   return NEW_NUMBER(fd);
+}
+
+/* Stop watching a file descriptor */
+DX(xunwatch_fd)
+{
+   ARG_NUMBER(1);
+   at *p = APOINTER(1);
+   if (RFILEP(p) || WFILEP(p))
+      fd_unwatch(fileno((FILE *)Gptr(p)));
+   else
+      fd_unwatch(AINTEGER(1));
+   return NIL;
+}
+
 /* Sleep for specified time (seconds) */
 DX(xsleep)
 {
@@ -861,6 +1108,13 @@ void init_event(void)
                  clear_event_timer, mark_event_timer, 0);
 
    MM_ROOT(timers);
+
+   mt_event_watch =
+      MM_REGTYPE("event_watch", sizeof(event_watch_t),
+                 clear_event_watch, mark_event_watch, 0);
+
+   MM_ROOT(watches);
+   MM_ROOT(disarmed);
    
    /* set up event queue */
    MM_ROOT(head);
@@ -881,6 +1135,10 @@ void init_event(void)
    dx_define("create-timer-absolute", xcreate_timer_absolute);
    dx_define("kill-timer", xkill_timer);
    dx_define("sleep", xsleep);
+
+   /* FILE DESCRIPTOR FUNCTIONS */
+   dx_define("watch-fd", xwatch_fd);
+   dx_define("unwatch-fd", xunwatch_fd);
 }
 
 
@@ -1317,6 +1317,7 @@ FILE *attempt_open_read(const char *s, const char *suffixes)
      }
      if (f) {
         FMODE_BINARY(f);
+        setvbuf(f, NULL, _IOFBF, READ_BUFFER);
         return f;
      }
   }
@@ -74,17 +74,21 @@ void clear_lfunction(lfunction_t *f, size_t _)
 {
    f->formal_args = NULL;
    f->body = NULL;
+   f->vars = NULL;
+   f->analyzed = false;
+   f->ncalls = 0;
 }
 
 void mark_lfunction(lfunction_t *f)
 {
    MM_MARK(f->formal_args);
    MM_MARK(f->body);
+   MM_MARK(f->vars);
 }
 
 static mt_t mt_lfunction = mt_undefined;
 
-static at *at_optional, *at_rest, *at_define_hook;
+static at *at_optional, *at_rest, *at_define_hook, *at_hot_hook;
 
 static void pop_args(at *formal_list)
 {
@@ -353,16 +357,173 @@ DY(name2(y,NAME)) \
 
 /* DE class -------------------------------------------	 */
 
+/*
+ * Flat formal argument lists, possibly with &optional
+ * and &rest parts, are analyzed on the first call.
+ * Array f->vars then holds the required and optional
+ * argument symbols, the optional defaults, and the rest symbol.
+ * Destructuring argument lists leave f->vars NULL.
+ */
+
+static void analyze_formals(lfunction_t *f)
+{
+   f->analyzed = true;
+   f->vars = NULL;
+
+   int nreq = 0, nopt = 0, rest = 0;
+   at *l = f->formal_args;
+   while (CONSP(l) && SYMBOLP(Car(l)) && Car(l)!=at_optional && Car(l)!=at_rest) {
+      nreq++;
+      l = Cdr(l);
+   }
+   at *opt = NIL;
+   if (CONSP(l) && Car(l)==at_optional) {
+      opt = l = Cdr(l);
+      for (; CONSP(l) && Car(l)!=at_rest; l = Cdr(l), nopt++) {
+         at *a = Car(l);
+         ifn (SYMBOLP(a) || (CONSP(a) && SYMBOLP(Car(a)) && LASTCONSP(Cdr(a))))
+            return;
+      }
+   }
+   if (CONSP(l) && Car(l)==at_rest) {
+      l = Cdr(l);
+      ifn (LASTCONSP(l) && SYMBOLP(Car(l)))
+         return;
+      l = Car(l);
+      rest = 2;
+   } else if (SYMBOLP(l))
+      rest = 1;
+   else if (l)
+      return;
+   if (nreq + nopt >= SHRT_MAX)
+      return;
+
+   at **vars = mm_allocv(mt_refs, (nreq + 2*nopt + 1) * sizeof(at *));
+   at *r = f->formal_args;
+   for (int i = 0; i < nreq; i++, r = Cdr(r))
+      vars[i] = Car(r);
+   for (int i = 0; i < nopt; i++, opt = Cdr(opt))
+      if (CONSP(Car(opt))) {
+         vars[nreq+i] = Caar(opt);
+         vars[nreq+nopt+i] = Cadr(Car(opt));
+      } else {
+         vars[nreq+i] = Car(opt);
+         vars[nreq+nopt+i] = NIL;
+      }
+   vars[nreq+2*nopt] = rest ? l : NIL;
+   f->nreq = nreq;
+   f->nopt = nopt;
+   f->rest = rest;
+   f->vars = vars;
+}
+
+/* bind the arguments at args[0] ... args[nargs-1] */
+static void push_analyzed_args(lfunction_t *f, at **args, int nargs)
+{
+   at **vars = f->vars;
+   int nreq = f->nreq;
+   int nopt = f->nopt;
+   if (nargs < nreq)
+      error(NIL, "missing arguments. expected", f->formal_args);
+   if (nargs > nreq + nopt && !f->rest)
+      error(NIL, "too many arguments. expected", f->formal_args);
+
+   for (int i = 0; i < nreq; i++)
+      SYMBOL_PUSH(vars[i], args[i]);
+   for (int i = nreq; i < nreq + nopt; i++)
+      SYMBOL_PUSH(vars[i], (i < nargs) ? args[i] : vars[i+nopt]);
+   if (f->rest) {
+      at *l = NIL;
+      for (int i = nargs-1; i >= nreq + nopt; i--)
+         l = new_cons(args[i], l);
+      if (f->rest == 2)
+         SYMBOL_PUSH(at_rest, NIL);
+      SYMBOL_PUSH(vars[nreq+2*nopt], l);
+   }
+}
+
+static void pop_analyzed_args(lfunction_t *f)
+{
+   at **vars = f->vars;
+   int n = f->nreq + f->nopt;
+   for (int i = 0; i < n; i++)
+      SYMBOL_POP(vars[i]);
+   if (f->rest) {
+      SYMBOL_POP(vars[n + f->nopt]);
+      if (f->rest == 2)
+         SYMBOL_POP(at_rest);
+   }
+}
+
+/*
+ * When hot_threshold is nonzero, de functions count their calls
+ * and invoke hot-function-hook every hot_threshold calls.
+ * Counting is suspended while the hook runs.
+ */
+
+static int hot_threshold = 0;
+
+static void call_hot_hook(at *s, at *p)
+{
+   at *hook = var_get(at_hot_hook);
+   if (hook && SYMBOLP(s)) {
+      struct lush_context mycontext;
+      int threshold = hot_threshold;
+      hot_threshold = 0;
+      context_push(&mycontext);
+      if (sigsetjmp(context->error_jump, 1)) {
+         if (!hot_threshold)
+            hot_threshold = threshold;
+         context_pop();
+         siglongjmp(context->error_jump, -1L);
+      }
+      apply(hook, new_cons(s, new_cons(p, NIL)));
+      context_pop();
+      /* keep a threshold set by the hook itself */
+      if (!hot_threshold)
+         hot_threshold = threshold;
+   }
+}
+
+DX(xhot_function_threshold)
+{
+   if (arg_number) {
+      ARG_NUMBER(1);
+      int n = AINTEGER(1);
+      if (n < 0)
+         RAISEFX("not a positive number", APOINTER(1));
+      hot_threshold = n;
+   }
+   return NEW_NUMBER(hot_threshold);
+}
+
 at *de_listeval(at *p, at *q)
 {
    MM_ENTER;
 
    lfunction_t *f = Mptr(p);
-   q = eval_arglist(Cdr(q));
-   push_args(f->formal_args, q);
-   at *ans = progn(f->body);
-   pop_args(f->formal_args);
-
+   if (hot_threshold && ++f->ncalls >= hot_threshold) {
+      f->ncalls = 0;
+      call_hot_hook(Car(q), p);
+   }
+   if (!f->analyzed)
+      analyze_formals(f);
+
+   at *ans;
+   if (f->vars) {
+      at **arg_pos = eval_arglist_dx(Cdr(q));
+      int nargs = (int)(dx_sp - arg_pos);
+      dx_sp = arg_pos;
+      push_analyzed_args(f, arg_pos + 1, nargs);
+      ans = progn(f->body);
+      pop_analyzed_args(f);
+
+   } else {
+      q = eval_arglist(Cdr(q));
+      push_args(f->formal_args, q);
+      ans = progn(f->body);
+      pop_args(f->formal_args);
+   }
    MM_RETURN(ans);
 }
 
@@ -421,18 +582,44 @@ DY_DEF(df)
 
 /* DM class -------------------------------------------	 */
 
+/*
+ * Macro expansions are cached by call site. An entry
+ * (site, arguments, macro, expansion) remains valid as long
+ * as the call site invokes the same macro with the same
+ * argument list. Redefining a macro creates a new DM
+ * and therefore invalidates its expansions.
+ */
+
+#define DM_CACHE_SIZE  4096
+
+static at **dm_cache = NULL;
 
 at *dm_listeval(at *p, at *q)
 {
    MM_ENTER;
 
+   at **e = NULL;
    lfunction_t *f = Mptr(p);
    if (last(q, 0))
       q = eval_arglist_dm(q);
+   else {
+      e = dm_cache + 4 * (hash_pointer(q) % DM_CACHE_SIZE);
+      if (e[0]==q && e[1]==Cdr(q) && e[2]==p) {
+         /* a nested call may evict the entry during evaluation */
+         at *m = e[3];
+         MM_ANCHOR(m);
+         MM_RETURN(eval(m));
+      }
+   }
    push_args(f->formal_args, q);
    at *m = progn(f->body);
    pop_args(f->formal_args);
-
+   if (e) {
+      e[0] = q;
+      e[1] = Cdr(q);
+      e[2] = p;
+      e[3] = m;
+   }
    MM_RETURN(eval(m));
 }
 
@@ -702,10 +889,13 @@ void init_function(void)
    dm_class = new_builtin_class(function_class);
    dm_class->listeval = dm_listeval;
    class_define("DM", dm_class);
+   dm_cache = mm_allocv(mt_refs, 4 * DM_CACHE_SIZE * sizeof(at *));
+   MM_ROOT(dm_cache);
 
    at_optional = var_define("&optional");
    at_rest = var_define("&rest");
    at_define_hook = var_define("define-hook");
+   at_hot_hook = var_define("hot-function-hook");
    
    dy_define("lambda", ylambda);
    dy_define("de", yde);
@@ -719,6 +909,7 @@ void init_function(void)
    dy_define("let*", yletS);
    dx_define("funcdef", xfuncdef);
    dx_define("functionp", xfunctionp);
+   dx_define("hot-function-threshold", xhot_function_threshold);
 }
 
 
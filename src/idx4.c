@@ -73,6 +73,8 @@ Xidx_2i1i1o(m2dotm1, Mcheck_main_main_maout_dot21)
 Xidx_4i2i2o(m4dotm2, Mcheck_main_main_maout_dot42)
 Xidx_2i1i1o(m2dotm1acc, Mcheck_main_main_maout_dot21)
 Xidx_4i2i2o(m4dotm2acc, Mcheck_main_main_maout_dot42)
+Xidx_2i2i2o(m2timesm2, Mcheck_main_main_maout_dot22)
+Xidx_2i2i2acc(m2timesm2acc, Mcheck_main_main_maout_dot22)
 
 /* ============== term by term operations ====== */
 
@@ -128,6 +130,12 @@ void init_idx4(void)
 #ifdef Midx_m4dotm2acc
   dx_define("idx-m4dotm2acc", Xidx_m4dotm2acc);
 #endif
+#ifdef Midx_m2timesm2
+  dx_define("idx-m2timesm2", Xidx_m2timesm2);
+#endif
+#ifdef Midx_m2timesm2acc
+  dx_define("idx-m2timesm2acc", Xidx_m2timesm2acc);
+#endif
 
 
 #ifdef Midx_maadd
@@ -28,6 +28,12 @@
 #include "header.h"
 #include <errno.h>
 #include <inttypes.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if HAVE_PTHREAD
+# include <pthread.h>
+#endif
 
 #define SHP0(S)  ((S)->ndims = 0, S)
 
@@ -1664,6 +1670,755 @@ DX(xarray_where_nonzero)
 }
 
 
+/* ------- SORTING ------- */
+
+/* 
+ * Lines along one dimension are sorted independently. Elements are
+ * mapped to unsigned keys that order like the values (descending
+ * order complements them) and sorted with a stable LSD radix sort,
+ * carrying the line positions when a payload array is permuted too.
+ * Long lines are cut into chunks sorted by different threads and
+ * merged; many short lines are distributed over threads.
+ */
+
+#define SORT_THREADS    8       /* maximal number of sorting threads */
+#define SORT_INSERTION  32      /* insertion sort below this length */
+#define SORT_MINSEG     (1<<18) /* elements per thread */
+#define SORT_NOFFS      256     /* line offsets kept on the stack */
+
+#define GenericSortFuncs(U, NBITS)                                      \
+static void name2(sort_insertion_,U)(U *u, uint32_t *ix, size_t n)      \
+{                                                                       \
+   for (size_t i = 1; i < n; i++) {                                     \
+      U k = u[i];                                                       \
+      uint32_t x = ix ? ix[i] : 0;                                      \
+      size_t j = i;                                                     \
+      for (; j > 0 && u[j-1] > k; j--) {                                \
+         u[j] = u[j-1];                                                 \
+         if (ix) ix[j] = ix[j-1];                                       \
+      }                                                                 \
+      u[j] = k;                                                         \
+      if (ix) ix[j] = x;                                                \
+   }                                                                    \
+}                                                                       \
+                                                                        \
+static void name2(sort_radix_,U)(U *u, uint32_t *ix, size_t n,          \
+                                 U *tu, uint32_t *tix)                  \
+{                                                                       \
+   if (n < SORT_INSERTION) {                                            \
+      name2(sort_insertion_,U)(u, ix, n);                               \
+      return;                                                           \
+   }                                                                    \
+   U *su = u, *du = tu;                                                 \
+   uint32_t *six = ix, *dix = tix;                                      \
+   for (int shift = 0; shift < NBITS; shift += 8) {                     \
+      size_t count[256];                                                \
+      memset(count, 0, sizeof(count));                                  \
+      for (size_t i = 0; i < n; i++)                                    \
+         count[(su[i] >> shift) & 0xff]++;                              \
+      if (count[(su[0] >> shift) & 0xff] == n)                          \
+         continue;                                                      \
+      size_t s = 0;                                                     \
+      for (int b = 0; b < 256; b++) {                                   \
+         size_t c = count[b];                                           \
+         count[b] = s;                                                  \
+         s += c;                                                        \
+      }                                                                 \
+      for (size_t i = 0; i < n; i++) {                                  \
+         size_t k = count[(su[i] >> shift) & 0xff]++;                   \
+         du[k] = su[i];                                                 \
+         if (six) dix[k] = six[i];                                      \
+      }                                                                 \
+      U *t = su; su = du; du = t;                                       \
+      uint32_t *tx = six; six = dix; dix = tx;                          \
+   }                                                                    \
+   if (su != u) {                                                       \
+      memcpy(u, su, n * sizeof(U));                                     \
+      if (ix) memcpy(ix, six, n * sizeof(uint32_t));                    \
+   }                                                                    \
+}                                                                       \
+                                                                        \
+/* stable merge of sorted runs [0,na) and [na,n) of u into tu */        \
+static void name2(sort_merge_,U)(U *u, uint32_t *ix, size_t na, size_t n, \
+                                 U *tu, uint32_t *tix)                  \
+{                                                                       \
+   size_t i = 0, j = na, k = 0;                                         \
+   while (i < na && j < n) {                                            \
+      size_t s = (u[j] < u[i]) ? j++ : i++;                             \
+      tu[k] = u[s];                                                     \
+      if (ix) tix[k] = ix[s];                                           \
+      k++;                                                              \
+   }                                                                    \
+   for (; i < na; i++, k++) {                                           \
+      tu[k] = u[i];                                                     \
+      if (ix) tix[k] = ix[i];                                           \
+   }                                                                    \
+   for (; j < n; j++, k++) {                                            \
+      tu[k] = u[j];                                                     \
+      if (ix) tix[k] = ix[j];                                           \
+   }                                                                    \
+}
+
+GenericSortFuncs(uint32_t, 32)
+GenericSortFuncs(uint64_t, 64)
+
+#undef GenericSortFuncs
+
+typedef struct sort_ctx {
+   index_t *m, *p;              /* keys and optional payload */
+   int d;                       /* dimension being sorted */
+   bool down;
+   bool wide;                   /* 64-bit keys */
+   size_t n;                    /* line length */
+   size_t nlines;
+   ptrdiff_t *moffs, *poffs;    /* offsets of the lines */
+} sort_ctx_t;
+
+typedef struct sort_job {
+   sort_ctx_t *c;
+   size_t first, last;          /* lines [first,last) */
+   size_t lo, hi;               /* or elements [lo,hi) of a single line */
+   void *u, *tu;                /* keys */
+   uint32_t *ix, *tix;          /* positions */
+   char *pb;                    /* payload buffer */
+} sort_job_t;
+
+/* encode line l of the keys into u and initialize the positions */
+static void sort_encode(sort_ctx_t *c, size_t l, void *u, uint32_t *ix)
+{
+   index_t *m = c->m;
+   ptrdiff_t mod = IND_MOD(m, c->d);
+   size_t n = c->n;
+
+   switch (IND_STTYPE(m)) {
+
+#define GenericEncode(Prefix, Type, U, Expr)                            \
+   case name2(ST_,Prefix): {                                            \
+      Type *e = IND_BASE_TYPED(m, Type) + c->moffs[l];                  \
+      U *k = u;                                                         \
+      for (size_t i = 0; i < n; i++, e += mod) {                        \
+         Type x = *e;                                                   \
+         k[i] = (Expr);                                                 \
+         if (c->down) k[i] = ~k[i];                                     \
+      }                                                                 \
+   } break;
+
+      GenericEncode(UCHAR, unsigned char, uint32_t, x);
+      GenericEncode(CHAR, char, uint32_t, (uint32_t)(uint8_t)x ^ 0x80);
+      GenericEncode(SHORT, short, uint32_t, (uint32_t)(uint16_t)x ^ 0x8000);
+      GenericEncode(INT, int, uint32_t, (uint32_t)x ^ 0x80000000u);
+      GenericEncode(FLOAT, float, uint32_t, 
+                    ({ uint32_t b; memcpy(&b, &x, 4);
+                       (b & 0x80000000u) ? ~b : b | 0x80000000u; }));
+      GenericEncode(DOUBLE, double, uint64_t,
+                    ({ uint64_t b; memcpy(&b, &x, 8);
+                       (b & 0x8000000000000000ull) ? ~b : b | 0x8000000000000000ull; }));
+#undef GenericEncode
+
+   default:
+      break;
+   }
+   if (ix)
+      for (size_t i = 0; i < n; i++)
+         ix[i] = i;
+}
+
+/* decode u into line l of the keys and permute the payload */
+static void sort_decode(sort_ctx_t *c, size_t l, void *u, uint32_t *ix, char *pb)
+{
+   index_t *m = c->m;
+   ptrdiff_t mod = IND_MOD(m, c->d);
+   size_t n = c->n;
+
+   switch (IND_STTYPE(m)) {
+
+#define GenericDecode(Prefix, Type, U, Expr)                            \
+   case name2(ST_,Prefix): {                                            \
+      Type *e = IND_BASE_TYPED(m, Type) + c->moffs[l];                  \
+      U *k = u;                                                         \
+      for (size_t i = 0; i < n; i++, e += mod) {                        \
+         U b = c->down ? ~k[i] : k[i];                                  \
+         *e = (Expr);                                                   \
+      }                                                                 \
+   } break;
+
+      GenericDecode(UCHAR, unsigned char, uint32_t, b);
+      GenericDecode(CHAR, char, uint32_t, (char)(uint8_t)(b ^ 0x80));
+      GenericDecode(SHORT, short, uint32_t, (short)(uint16_t)(b ^ 0x8000));
+      GenericDecode(INT, int, uint32_t, (int)(b ^ 0x80000000u));
+      GenericDecode(FLOAT, float, uint32_t,
+                    ({ float x; b = (b & 0x80000000u) ? b & 0x7fffffffu : ~b;
+                       memcpy(&x, &b, 4); x; }));
+      GenericDecode(DOUBLE, double, uint64_t,
+                    ({ double x; b = (b & 0x8000000000000000ull) ? 
+                          b & 0x7fffffffffffffffull : ~b;
+                       memcpy(&x, &b, 8); x; }));
+#undef GenericDecode
+
+   default:
+      break;
+   }
+
+   if (c->p) {
+      index_t *p = c->p;
+      size_t sz = storage_sizeof[IND_STTYPE(p)];
+      ptrdiff_t pmod = IND_MOD(p, c->d) * sz;
+      char *e = (char *)IND_BASE(p) + c->poffs[l] * sz;
+      for (size_t i = 0; i < n; i++)
+         memcpy(pb + i*sz, e + ix[i]*pmod, sz);
+      for (size_t i = 0; i < n; i++, e += pmod)
+         memcpy(e, pb + i*sz, sz);
+   }
+}
+
+static void sort_keys(sort_ctx_t *c, void *u, uint32_t *ix, size_t n, void *tu, uint32_t *tix)
+{
+   if (c->wide)
+      sort_radix_uint64_t(u, ix, n, tu, tix);
+   else
+      sort_radix_uint32_t(u, ix, n, tu, tix);
+}
+
+static void *sort_lines(void *arg)
+{
+   sort_job_t *j = arg;
+   for (size_t l = j->first; l < j->last; l++) {
+      sort_encode(j->c, l, j->u, j->ix);
+      sort_keys(j->c, j->u, j->ix, j->c->n, j->tu, j->tix);
+      sort_decode(j->c, l, j->u, j->ix, j->pb);
+   }
+   return NULL;
+}
+
+static void *sort_chunk(void *arg)
+{
+   sort_job_t *j = arg;
+   size_t ks = j->c->wide ? 8 : 4;
+   sort_keys(j->c, (char *)j->u + j->lo*ks, j->ix ? j->ix + j->lo : NULL, 
+             j->hi - j->lo, (char *)j->tu + j->lo*ks, j->tix ? j->tix + j->lo : NULL);
+   return NULL;
+}
+
+static void sort_run(void *(*f)(void *), sort_job_t *jobs, int nt)
+{
+#if HAVE_PTHREAD
+   pthread_t threads[SORT_THREADS];
+   bool started[SORT_THREADS];
+   for (int i = 1; i < nt; i++)
+      started[i] = !start_worker(&threads[i], f, &jobs[i]);
+   (*f)(&jobs[0]);
+   for (int i = 1; i < nt; i++)
+      if (started[i])
+         pthread_join(threads[i], NULL);
+      else
+         (*f)(&jobs[i]);
+#else
+   for (int i = 0; i < nt; i++)
+      (*f)(&jobs[i]);
+#endif
+}
+
+/* sort the lines of m along dimension d, permuting p alike */
+void array_sort(index_t *m, int d, index_t *p, bool down)
+{
+   switch (IND_STTYPE(m)) {
+   case ST_UCHAR: case ST_CHAR: case ST_SHORT: 
+   case ST_INT: case ST_FLOAT: case ST_DOUBLE:
+      break;
+   default:
+      RAISEF("element-type not supported", NIL);
+   }
+   if (IND_NDIMS(m) < 1)
+      RAISEF("array must not be scalar", m->backptr);
+   if (d < 0 || d >= IND_NDIMS(m))
+      RAISEF("invalid dimension", NEW_NUMBER(d));
+   if (p && !shape_equalp(IND_SHAPE(m), IND_SHAPE(p)))
+      RAISEF("arrays must have the same shape", p->backptr);
+   if (IND_DIM(m, d) > UINT32_MAX)
+      RAISEF("dimension too large for sorting", NIL);
+
+   sort_ctx_t c;
+   c.m = m;
+   c.p = p;
+   c.d = d;
+   c.down = down;
+   c.wide = IND_STTYPE(m) == ST_DOUBLE;
+   c.n = IND_DIM(m, d);
+   c.nlines = index_nelems(m) / (c.n ? c.n : 1);
+   if (c.n < 2 || c.nlines == 0)
+      return;
+
+   static int ncpu = 0;
+   if (! ncpu) {
+#ifdef _SC_NPROCESSORS_ONLN
+      ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+      ncpu = (ncpu < 1) ? 1 : (ncpu > SORT_THREADS) ? SORT_THREADS : ncpu;
+   }
+   size_t total = c.n * c.nlines;
+   int nt = total / SORT_MINSEG;
+   nt = (nt < 1) ? 1 : (nt > ncpu) ? ncpu : nt;
+   bool split = c.nlines < nt;
+   int nb = split ? 1 : nt;    /* line buffers */
+
+   /* allocate line offsets and buffers */
+   size_t ks = c.wide ? 8 : 4;
+   size_t ps = p ? storage_sizeof[IND_STTYPE(p)] : 0;
+   size_t lsz = c.n * (2*ks + (p ? 2*sizeof(uint32_t) + ps : 0));
+   ptrdiff_t offs[2*SORT_NOFFS];
+   c.moffs = (c.nlines <= SORT_NOFFS) ? offs : malloc(c.nlines * sizeof(ptrdiff_t) * 2);
+   char *buf = malloc(lsz * nb);
+   if (!c.moffs || !buf) {
+      if (c.moffs != offs)
+         free(c.moffs);
+      free(buf);
+      RAISEF("not enough memory", NIL);
+   }
+   c.poffs = c.moffs + c.nlines;
+   {
+      index_t *mv = index_select(m, d, 0);
+      index_t *pv = p ? index_select(p, d, 0) : mv;
+      size_t l = 0;
+      begin_idx_aloop2(mv, pv, mo, po) {
+         c.moffs[l] = mo;
+         c.poffs[l++] = po;
+      } end_idx_aloop2(mv, pv, mo, po);
+   }
+   
+   sort_job_t jobs[SORT_THREADS];
+   for (int i = 0; i < nb; i++) {
+      char *b = buf + i*lsz;
+      jobs[i].c = &c;
+      jobs[i].u = b;
+      jobs[i].tu = b + c.n*ks;
+      jobs[i].ix = p ? (uint32_t *)(b + 2*c.n*ks) : NULL;
+      jobs[i].tix = p ? jobs[i].ix + c.n : NULL;
+      jobs[i].pb = p ? (char *)(jobs[i].tix + c.n) : NULL;
+   }
+
+   if (!split) {
+      /* distribute the lines */
+      for (int i = 0; i < nt; i++) {
+         jobs[i].first = c.nlines * i / nt;
+         jobs[i].last = c.nlines * (i+1) / nt;
+      }
+      sort_run(sort_lines, jobs, nt);
+
+   } else {
+      /* sort chunks of each line and merge them */
+      for (size_t l = 0; l < c.nlines; l++) {
+         sort_encode(&c, l, jobs[0].u, jobs[0].ix);
+         size_t bounds[SORT_THREADS+1];
+         for (int i = 0; i <= nt; i++)
+            bounds[i] = c.n * i / nt;
+         for (int i = 0; i < nt; i++) {
+            jobs[i] = jobs[0];
+            jobs[i].lo = bounds[i];
+            jobs[i].hi = bounds[i+1];
+         }
+         sort_run(sort_chunk, jobs, nt);
+         void *u = jobs[0].u, *tu = jobs[0].tu;
+         uint32_t *ix = jobs[0].ix, *tix = jobs[0].tix;
+         for (int w = 1; w < nt; w *= 2) {
+            for (int i = 0; i < nt; i += 2*w) {
+               size_t lo = bounds[i];
+               size_t mid = bounds[(i+w < nt) ? i+w : nt];
+               size_t hi = bounds[(i+2*w < nt) ? i+2*w : nt];
+               if (c.wide)
+                  sort_merge_uint64_t((uint64_t *)u + lo, ix ? ix + lo : NULL, mid - lo, hi - lo,
+                                      (uint64_t *)tu + lo, tix ? tix + lo : NULL);
+               else
+                  sort_merge_uint32_t((uint32_t *)u + lo, ix ? ix + lo : NULL, mid - lo, hi - lo,
+                                      (uint32_t *)tu + lo, tix ? tix + lo : NULL);
+            }
+            void *t = u; u = tu; tu = t;
+            uint32_t *tx = ix; ix = tix; tix = tx;
+         }
+         sort_decode(&c, l, u, ix, jobs[0].pb);
+      }
+   }
+   free(buf);
+   if (c.moffs != offs)
+      free(c.moffs);
+}
+
+DX(xarray_sort)
+{
+   if (arg_number<1 || arg_number>3)
+      ARG_NUMBER(-1);
+   index_t *p = NULL;
+   int d = 0;
+   for (int i = 2; i <= arg_number; i++)
+      if (INDEXP(APOINTER(i)))
+         p = AINDEX(i);
+      else
+         d = AINTEGER(i);
+   array_sort(AINDEX(1), d, p, false);
+   return NIL;
+}
+
+DX(xarray_sort_down)
+{
+   if (arg_number<1 || arg_number>3)
+      ARG_NUMBER(-1);
+   index_t *p = NULL;
+   int d = 0;
+   for (int i = 2; i <= arg_number; i++)
+      if (INDEXP(APOINTER(i)))
+         p = AINDEX(i);
+      else
+         d = AINTEGER(i);
+   array_sort(AINDEX(1), d, p, true);
+   return NIL;
+}
+
+
+
+
+/* ------- REDUCTIONS ------- */
+
+/*
+ * A reduction along dimension d computes one result per line of the
+ * array along d. Results are produced by chunks of RED_CHUNK adjacent
+ * lines. When the lines are further apart than their elements, each
+ * line is reduced in turn; otherwise the lines of a chunk advance
+ * together, so that row and column reductions both read memory in
+ * order. Chunks are processed by several threads, and stored into
+ * the result arrays with their own element type and strides.
+ */
+
+#define RED_CHUNK   256
+#define RED_GRAIN   (1<<16)    /* elements per tile */
+
+static const char *reduce_names[] = {
+   "array-sum-along", "array-mean-along", "array-var-along", 
+   "array-sup-along", "array-inf-along"
+};
+
+typedef struct {
+   enum reduce_op op;
+   storage_type_t type;
+   gptr x;                   /* base of the array */
+   size_t n;                 /* elements per line */
+   ptrdiff_t md, ml;         /* strides along and across lines */
+   bool across;              /* advance the lines of a chunk together */
+   size_t nl, nchunks;       /* lines per row of results, chunks per row */
+   int nrd;                  /* dimensions enumerating the rows */
+   size_t rdim[MAXDIMS];
+   ptrdiff_t mmod[MAXDIMS];  /* their strides in the array, */
+   ptrdiff_t rmod[MAXDIMS];  /* in the results, */
+   ptrdiff_t pmod[MAXDIMS];  /* and in the positions */
+   index_t *r, *p;           /* results, and positions for sup and inf */
+   ptrdiff_t rl, pl;         /* strides of r and p across lines */
+} reduce_ctx_t;
+
+#define GenericReduce(Prefix, Type)                                     \
+static void name2(reduce_,Prefix)(const reduce_ctx_t *c, const Type *x, \
+                                  size_t nk, double *s, double *s2, int *a) \
+{                                                                       \
+   size_t n = c->n;                                                     \
+   ptrdiff_t md = c->md, ml = c->ml;                                    \
+   switch (c->op) {                                                     \
+   case RED_SUM: case RED_MEAN:                                         \
+      if (c->across) {                                                  \
+         for (size_t k = 0; k < nk; k++)                                \
+            s[k] = 0;                                                   \
+         for (size_t j = 0; j < n; j++, x += md)                        \
+            for (size_t k = 0; k < nk; k++)                             \
+               s[k] += x[k*ml];                                         \
+      } else                                                            \
+         for (size_t k = 0; k < nk; k++) {                              \
+            const Type *y = x + k*ml;                                   \
+            double f = 0;                                               \
+            for (size_t j = 0; j < n; j++)                              \
+               f += y[j*md];                                            \
+            s[k] = f;                                                   \
+         }                                                              \
+      break;                                                            \
+   case RED_VAR:                                                        \
+      /* moments about the first element of each line */                \
+      if (c->across) {                                                  \
+         for (size_t k = 0; k < nk; k++)                                \
+            s[k] = s2[k] = 0;                                           \
+         for (size_t j = 1; j < n; j++)                                 \
+            for (size_t k = 0; k < nk; k++) {                           \
+               double f = (double)x[j*md + k*ml] - x[k*ml];             \
+               s[k] += f;                                               \
+               s2[k] += f * f;                                          \
+            }                                                           \
+      } else                                                            \
+         for (size_t k = 0; k < nk; k++) {                              \
+            const Type *y = x + k*ml;                                   \
+            double f1 = 0, f2 = 0;                                      \
+            for (size_t j = 1; j < n; j++) {                            \
+               double f = (double)y[j*md] - y[0];                       \
+               f1 += f;                                                 \
+               f2 += f * f;                                             \
+            }                                                           \
+            s[k] = f1;                                                  \
+            s2[k] = f2;                                                 \
+         }                                                              \
+      break;                                                            \
+   case RED_SUP: case RED_INF: {                                        \
+      bool up = c->op == RED_SUP;                                       \
+      if (c->across) {                                                  \
+         for (size_t k = 0; k < nk; k++) {                              \
+            s[k] = x[k*ml];                                             \
+            a[k] = 0;                                                   \
+         }                                                              \
+         for (size_t j = 1; j < n; j++)                                 \
+            for (size_t k = 0; k < nk; k++) {                           \
+               double f = x[j*md + k*ml];                               \
+               if (up ? f > s[k] : f < s[k]) {                          \
+                  s[k] = f;                                             \
+                  a[k] = j;                                             \
+               }                                                        \
+            }                                                           \
+      } else                                                            \
+         for (size_t k = 0; k < nk; k++) {                              \
+            const Type *y = x + k*ml;                                   \
+            Type f = y[0];                                              \
+            size_t b = 0;                                               \
+            for (size_t j = 1; j < n; j++)                              \
+               if (up ? y[j*md] > f : y[j*md] < f) {                    \
+                  f = y[j*md];                                          \
+                  b = j;                                                \
+               }                                                        \
+            s[k] = f;                                                   \
+            a[k] = b;                                                   \
+         }                                                              \
+   } break;                                                             \
+   }                                                                    \
+}
+
+GenericReduce(UCHAR, unsigned char)
+GenericReduce(CHAR, char)
+GenericReduce(SHORT, short)
+GenericReduce(INT, int)
+GenericReduce(FLOAT, float)
+GenericReduce(DOUBLE, double)
+
+#undef GenericReduce
+
+/* store v[0..nk) into array x with stride mod, converting to type */
+static void reduce_store(storage_type_t type, gptr x, ptrdiff_t mod,
+                         const double *v, const int *a, size_t nk)
+{
+   switch (type) {
+#define GenericStore(Prefix, Type)                                      \
+   case name2(ST_,Prefix): {                                            \
+      Type *y = (Type *)x;                                              \
+      if (v)                                                            \
+         for (size_t k = 0; k < nk; k++)                                \
+            y[k*mod] = (Type)v[k];                                      \
+      else                                                              \
+         for (size_t k = 0; k < nk; k++)                                \
+            y[k*mod] = (Type)a[k];                                      \
+   } break;
+      GenericStore(UCHAR, unsigned char)
+      GenericStore(CHAR, char)
+      GenericStore(SHORT, short)
+      GenericStore(INT, int)
+      GenericStore(FLOAT, float)
+      GenericStore(DOUBLE, double)
+#undef GenericStore
+   default:
+      break;
+   }
+}
+
+static void reduce_tiles(void *arg, ptrdiff_t lo, ptrdiff_t hi)
+{
+   const reduce_ctx_t *c = arg;
+   double r[RED_CHUNK], s2[RED_CHUNK];
+   int a[RED_CHUNK];
+   for (ptrdiff_t t = lo; t < hi; t++) {
+      size_t row = t / c->nchunks;
+      size_t k0 = (t % c->nchunks) * RED_CHUNK;
+      size_t nk = (c->nl - k0 < RED_CHUNK) ? c->nl - k0 : RED_CHUNK;
+
+      /* locate the row, last dimension varying fastest */
+      ptrdiff_t o = 0, ro = 0, po = 0;
+      size_t q = row;
+      for (int i = c->nrd - 1; i >= 0; i--) {
+         size_t j = q % c->rdim[i];
+         q /= c->rdim[i];
+         o += j * c->mmod[i];
+         ro += j * c->rmod[i];
+         po += j * c->pmod[i];
+      }
+      o += k0 * c->ml;
+
+      switch (c->type) {
+#define GenericCall(Prefix, Type)                                       \
+      case name2(ST_,Prefix):                                           \
+         name2(reduce_,Prefix)(c, (const Type *)c->x + o, nk, r, s2, a); \
+         break;
+         GenericCall(UCHAR, unsigned char)
+         GenericCall(CHAR, char)
+         GenericCall(SHORT, short)
+         GenericCall(INT, int)
+         GenericCall(FLOAT, float)
+         GenericCall(DOUBLE, double)
+#undef GenericCall
+      default:
+         break;
+      }
+
+      double n = c->n;
+      if (c->op == RED_MEAN)
+         for (size_t k = 0; k < nk; k++)
+            r[k] /= n;
+      else if (c->op == RED_VAR)
+         for (size_t k = 0; k < nk; k++)
+            r[k] = (s2[k] - r[k]*r[k]/n) / n;
+
+      index_t *ri = c->r;
+      reduce_store(IND_STTYPE(ri), 
+                   (char *)IND_BASE(ri) + (ro + k0 * c->rl) * storage_sizeof[IND_STTYPE(ri)],
+                   c->rl, r, NULL, nk);
+      if (c->p) {
+         index_t *pi = c->p;
+         reduce_store(IND_STTYPE(pi),
+                      (char *)IND_BASE(pi) + (po + k0 * c->pl) * storage_sizeof[IND_STTYPE(pi)],
+                      c->pl, NULL, a, nk);
+      }
+   }
+}
+
+static bool reduce_typep(index_t *x)
+{
+   switch (IND_STTYPE(x)) {
+   case ST_UCHAR: case ST_CHAR: case ST_SHORT: 
+   case ST_INT: case ST_FLOAT: case ST_DOUBLE:
+      return true;
+   default:
+      return false;
+   }
+}
+
+index_t *array_reduce_along(index_t *m, int d, enum reduce_op op, index_t *r, index_t *p)
+{
+   const char *name = reduce_names[op];
+   storage_type_t type = IND_STTYPE(m);
+   if (!reduce_typep(m))
+      RAISE(name, "element-type not supported", NIL);
+   if (IND_NDIMS(m) < 1)
+      RAISE(name, "array must not be scalar", m->backptr);
+   if (d < 0)
+      d += IND_NDIMS(m);
+   if (d < 0 || d >= IND_NDIMS(m))
+      RAISE(name, "invalid dimension", NEW_NUMBER(d));
+   if (IND_DIM(m, d) == 0 && op != RED_SUM)
+      RAISE(name, "empty dimension", NEW_NUMBER(d));
+   if (IND_DIM(m, d) > INT_MAX)
+      RAISE(name, "dimension too large", NEW_NUMBER(d));
+
+   /* the results have the shape of m without dimension d */
+   shape_t shape, *shp = &shape;
+   shp->ndims = 0;
+   for (int i = 0; i < IND_NDIMS(m); i++)
+      if (i != d)
+         shp->dim[shp->ndims++] = IND_DIM(m, i);
+   if (r && !shape_equalp(IND_SHAPE(r), shp))
+      RAISE(name, "result array has wrong shape", r->backptr);
+   if (r && !reduce_typep(r))
+      RAISE(name, "result element-type not supported", r->backptr);
+   if (p && !shape_equalp(IND_SHAPE(p), shp))
+      RAISE(name, "index array has wrong shape", p->backptr);
+   if (p && !reduce_typep(p))
+      RAISE(name, "index element-type not supported", p->backptr);
+   if (op != RED_SUP && op != RED_INF)
+      p = NULL;
+   if (!r)
+      r = make_array((op == RED_SUP || op == RED_INF) ? type : ST_DOUBLE, shp, NIL);
+
+   size_t nres = shape_nelems(shp);
+   if (nres > 0) {
+      /* lines of a chunk run along the last dimension of the results */
+      int last = IND_NDIMS(m) - 1;
+      if (last == d)
+         last--;
+      reduce_ctx_t c;
+      c.op = op;
+      c.type = type;
+      c.x = IND_BASE(m);
+      c.n = IND_DIM(m, d);
+      c.md = IND_MOD(m, d);
+      c.nl = (last >= 0) ? IND_DIM(m, last) : 1;
+      c.ml = (last >= 0) ? IND_MOD(m, last) : 0;
+      c.across = c.nl > 1 && labs(c.ml) < labs(c.md);
+      c.nchunks = (c.nl + RED_CHUNK - 1) / RED_CHUNK;
+      c.r = r;
+      c.p = p;
+      int rlast = (last > d) ? last - 1 : last;
+      c.rl = (rlast >= 0) ? IND_MOD(r, rlast) : 0;
+      c.pl = (p && rlast >= 0) ? IND_MOD(p, rlast) : 0;
+      c.nrd = 0;
+      for (int i = 0; i < IND_NDIMS(m); i++)
+         if (i != d && i != last) {
+            int ri = (i > d) ? i - 1 : i;
+            c.rdim[c.nrd] = IND_DIM(m, i);
+            c.mmod[c.nrd] = IND_MOD(m, i);
+            c.rmod[c.nrd] = IND_MOD(r, ri);
+            c.pmod[c.nrd++] = p ? IND_MOD(p, ri) : 0;
+         }
+
+      size_t nrows = nres / c.nl;
+      size_t work = c.n * ((c.nl < RED_CHUNK) ? c.nl : RED_CHUNK);
+      run_tiles(reduce_tiles, &c, nrows * c.nchunks, 1 + RED_GRAIN / (work ? work : 1));
+   }
+   return r;
+}
+
+/* arguments are (m [d] [r] [p]) */
+static at *reduce_dx(int arg_number, at **arg_array, enum reduce_op op)
+{
+   int nres = (op == RED_SUP || op == RED_INF) ? 2 : 1;
+   if (arg_number<1 || arg_number>2+nres)
+      ARG_NUMBER(-1);
+   index_t *r = NULL, *p = NULL;
+   int d = -1, k = 0;
+   for (int i = 2; i <= arg_number; i++)
+      if (NUMBERP(APOINTER(i)))
+         d = AINTEGER(i);
+      else if (k < nres) {
+         index_t *x = APOINTER(i) ? AINDEX(i) : NULL;
+         if (k++ == 0)
+            r = x;
+         else
+            p = x;
+      } else
+         ARG_NUMBER(-1);
+   return array_reduce_along(AINDEX(1), d, op, r, p)->backptr;
+}
+
+DX(xarray_sum_along)
+{
+   return reduce_dx(arg_number, arg_array, RED_SUM);
+}
+
+DX(xarray_mean_along)
+{
+   return reduce_dx(arg_number, arg_array, RED_MEAN);
+}
+
+DX(xarray_var_along)
+{
+   return reduce_dx(arg_number, arg_array, RED_VAR);
+}
+
+DX(xarray_sup_along)
+{
+   return reduce_dx(arg_number, arg_array, RED_SUP);
+}
+
+DX(xarray_inf_along)
+{
+   return reduce_dx(arg_number, arg_array, RED_INF);
+}
+
+
 index_t *index_copy(index_t *src, index_t *dest)
 {
    memcpy(dest, src, sizeof(index_t));
@@ -2065,46 +2820,472 @@ DX(ximport_array)
 }
 
 
-void import_array_text(index_t *ind, FILE *f)
+/* -------- Parsing numbers from text ------ */
+
+#define TEXT_BLOCK    (8<<20)   /* bytes of text parsed at once */
+#define TEXT_MINSEG   (1<<18)   /* minimal number of bytes per thread */
+#define TEXT_THREADS  8         /* maximal number of parsing threads */
+
+#define TEXT_BLANK(c) ((c)==' ' || (c)=='\t' || (c)=='\r' || (c)=='\f' || (c)=='\v')
+#define TEXT_SEP(c)   (TEXT_BLANK(c) || (c)=='\n' || (c)==',')
+
+static const double text_pow10[] = {
+   1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/* 
+ * Parse the number starting at <s> and ending before a separator.
+ * Decimal numbers with at most 15 significant digits and small
+ * exponents are converted exactly without calling strtod.
+ * Return a pointer to the end of the number or NULL.
+ */
+static const char *text_real(const char *s, const char *e, double *x)
+{
+   const char *t = s;
+   bool neg = false, digits = false;
+   uint64_t m = 0;
+   int nd = 0, ex = 0;
+   
+   if (t<e && (*t=='-' || *t=='+'))
+      neg = (*t++ == '-');
+   for (; t<e && *t>='0' && *t<='9'; t++, digits = true)
+      if (nd < 19) {
+         m = m*10 + (*t - '0');
+         nd += (m != 0);
+      } else 
+         ex++, nd++;
+   if (t<e && *t=='.') {
+      for (t++; t<e && *t>='0' && *t<='9'; t++, digits = true)
+         if (nd < 19) {
+            m = m*10 + (*t - '0');
+            nd += (m != 0);
+            ex--;
+         } else
+            nd++;
+   }
+   if (digits && t<e && (*t=='e' || *t=='E')) {
+      const char *u = t+1;
+      bool eneg = false;
+      int ev = 0;
+      if (u<e && (*u=='-' || *u=='+'))
+         eneg = (*u++ == '-');
+      if (u<e && *u>='0' && *u<='9') {
+         for (; u<e && *u>='0' && *u<='9'; u++)
+            if (ev < 10000)
+               ev = ev*10 + (*u - '0');
+         ex += eneg ? -ev : ev;
+         t = u;
+      } else
+         digits = false;
+   }
+   if (digits && (t==e || TEXT_SEP(*t)) && nd <= 15 && ex >= -22 && ex <= 22) {
+      double d = (double)m;
+      d = (ex < 0) ? d / text_pow10[-ex] : d * text_pow10[ex];
+      *x = neg ? -d : d;
+      return t;
+   }
+   /* slow path: nan, inf, hexadecimal, long mantissas */
+   char *end;
+   *x = strtod(s, &end);
+   if (end == s || (end < e && !TEXT_SEP(*end)))
+      return NULL;
+   return end;
+}
+
+typedef struct text_job {
+   const char *s, *e;          /* text to parse */
+   const int *colpos;          /* column -> position within a row, or -1 */
+   int ncols, maxcol;          /* number of selected columns, largest column */
+   void (*setd)(gptr,size_t,real);
+   gptr base;                  /* destination */
+   size_t off, n;              /* destination offset and number of values */
+   const char *end;            /* end of the parsed text */
+   const char *err;            /* location of a syntax error */
+} text_job_t;
+
+/* Count the numbers that <text_parse> would find in a job */
+static size_t text_count(const char *s, const char *e, int ncols)
+{
+   size_t n = 0;
+   if (ncols) {
+      /* count non blank lines */
+      bool blank = true;
+      for (; s<e; s++)
+         if (*s == '\n') {
+            n += !blank;
+            blank = true;
+         } else if (!TEXT_BLANK(*s))
+            blank = false;
+      n += !blank;
+      return n * ncols;
+   }
+   /* count tokens */
+   bool sep = true;
+   for (; s<e; s++) {
+      bool c = TEXT_SEP(*s);
+      n += (sep && !c);
+      sep = c;
+   }
+   return n;
+}
+
+/* Parse at most j->n numbers and store them */
+static void *text_parse(void *arg)
+{
+   text_job_t *j = arg;
+   const char *s = j->s, *e = j->e;
+   size_t k = 0;
+   double x;
+
+   j->err = NULL;
+   if (! j->ncols) {
+      while (k < j->n) {
+         while (s<e && TEXT_SEP(*s))
+            s++;
+         if (s >= e)
+            break;
+         const char *t = text_real(s, e, &x);
+         if (! t) {
+            j->err = s;
+            break;
+         }
+         (*j->setd)(j->base, j->off + k++, x);
+         s = t;
+      }
+      while (s<e && isspace((unsigned char)*s))
+         s++;
+
+   } else {
+      while (k < j->n && s < e) {
+         int fi = 0, found = 0;
+         while (s<e && TEXT_BLANK(*s))
+            s++;
+         if (s<e && *s=='\n') {
+            s++;
+            continue;
+         }
+         /* fields are separated by blanks or by one comma */
+         while (found < j->ncols) {
+            if (fi <= j->maxcol && j->colpos[fi] >= 0) {
+               const char *t = (s<e && !TEXT_SEP(*s)) ? text_real(s, e, &x) : NULL;
+               if (! t) {
+                  j->err = s;
+                  break;
+               }
+               (*j->setd)(j->base, j->off + k + j->colpos[fi], x);
+               found++;
+               s = t;
+            } else
+               while (s<e && !TEXT_SEP(*s))
+                  s++;
+            fi++;
+            while (s<e && TEXT_BLANK(*s))
+               s++;
+            if (s>=e || *s=='\n')
+               break;
+            if (*s == ',') 
+               for (s++; s<e && TEXT_BLANK(*s); s++)
+                  ;
+         }
+         if (j->err)
+            break;
+         if (found < j->ncols) {
+            j->err = s;
+            break;
+         }
+         k += j->ncols;
+         while (s<e && *s!='\n')
+            s++;
+         if (s<e)
+            s++;
+      }
+   }
+   j->n = k;
+   j->end = s;
+   return NULL;
+}
+
+/* Split [s,e) at record boundaries and parse segments concurrently */
+static size_t text_parse_block(text_job_t *tmpl, const char *s, const char *e,
+                               size_t off, size_t need, const char **endp, const char **errp)
+{
+   text_job_t jobs[TEXT_THREADS];
+   int nt = (e - s) / TEXT_MINSEG;
+   static int ncpu = 0;
+   if (! ncpu) {
+#ifdef _SC_NPROCESSORS_ONLN
+      ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+      ncpu = (ncpu < 1) ? 1 : (ncpu > TEXT_THREADS) ? TEXT_THREADS : ncpu;
+   }
+   nt = (nt < 1) ? 1 : (nt > ncpu) ? ncpu : nt;
+
+   /* segment boundaries */
+   const char *b = s;
+   for (int i = 0; i < nt; i++) {
+      const char *c = (i == nt-1) ? e : s + (e - s) * (i+1) / nt;
+      if (c < b)
+         c = b;
+      while (c < e && (tmpl->ncols ? c[-1] != '\n' : !TEXT_SEP(c[-1])))
+         c++;
+      jobs[i] = *tmpl;
+      jobs[i].s = b;
+      jobs[i].e = c;
+      b = c;
+   }
+   /* counts decide destination offsets */
+   size_t done = 0;
+   int last = nt - 1;
+   for (int i = 0; i < nt; i++) {
+      size_t n = text_count(jobs[i].s, jobs[i].e, tmpl->ncols);
+      jobs[i].off = off + done;
+      jobs[i].n = (n < need - done) ? n : need - done;
+      done += jobs[i].n;
+      if (done == need) {
+         last = i;
+         break;
+      }
+   }
+   nt = last + 1;
+#if HAVE_PTHREAD
+   pthread_t threads[TEXT_THREADS];
+   bool started[TEXT_THREADS];
+   for (int i = 1; i < nt; i++)
+      started[i] = !start_worker(&threads[i], text_parse, &jobs[i]);
+   text_parse(&jobs[0]);
+   for (int i = 1; i < nt; i++)
+      if (started[i])
+         pthread_join(threads[i], NULL);
+      else
+         text_parse(&jobs[i]);
+#else
+   for (int i = 0; i < nt; i++)
+      text_parse(&jobs[i]);
+#endif
+   /* the first error wins */
+   done = 0;
+   *errp = NULL;
+   *endp = s;
+   for (int i = 0; i < nt; i++) {
+      done += jobs[i].n;
+      *endp = jobs[i].end;
+      if (jobs[i].err) {
+         *errp = jobs[i].err;
+         break;
+      }
+   }
+   return done;
+}
+
+/* Parse text from a seekable file by large blocks */
+static const char *import_text_blocks(text_job_t *tmpl, FILE *f, size_t size)
+{
+   off_t pos = ftello(f);
+   char *buf = malloc(TEXT_BLOCK + 1);
+   size_t have = 0, done = 0;
+   const char *errmsg = NULL;
+   if (pos < 0 || !buf) {
+      free(buf);
+      return "cannot read file";
+   }
+   while (done < size) {
+      errno = 0;
+      size_t r = fread(buf + have, 1, TEXT_BLOCK - have, f);
+      if (r < TEXT_BLOCK - have && ferror(f)) {
+         errmsg = strerror(errno);
+         break;
+      }
+      size_t len = have + r;
+      size_t cut = len;
+      if (len == TEXT_BLOCK) {
+         /* stop after the last complete record */
+         while (cut > 0 && (tmpl->ncols ? buf[cut-1] != '\n' : !TEXT_SEP(buf[cut-1])))
+            cut--;
+         if (cut == 0) {
+            errmsg = "line too long";
+            break;
+         }
+      }
+      buf[len] = 0;
+      const char *end = buf, *err;
+      done += text_parse_block(tmpl, buf, buf + cut, done, size - done, &end, &err);
+      if (err) {
+         errmsg = "Cannot read a number";
+         break;
+      } 
+      if (done == size) {
+         pos += end - buf;
+         break;
+      } else if (len < TEXT_BLOCK) {
+         errmsg = "file is too short";
+         break;
+      }
+      memmove(buf, buf + cut, len - cut);
+      have = len - cut;
+      pos += cut;
+   }
+   free(buf);
+   if (!errmsg && fseeko(f, pos, SEEK_SET) < 0)
+      errmsg = strerror(errno);
+   return errmsg;
+}
+
+/* Parse text from a stream one token or one line at a time */
+static const char *import_text_stream(text_job_t *tmpl, FILE *f, size_t size)
+{
+   char tok[128];
+   size_t done = 0;
+   double x;
+   int c = 0;
+
+   if (! tmpl->ncols) {
+      while (done < size) {
+         int i = 0;
+         while ((c = getc(f)) != EOF && TEXT_SEP(c))
+            ;
+         for (; c != EOF && !TEXT_SEP(c); c = getc(f))
+            if (i < (int)sizeof(tok) - 1)
+               tok[i++] = c;
+         if (c != EOF)
+            ungetc(c, f);
+         if (i == 0)
+            return "file is too short";
+         tok[i] = 0;
+         if (! text_real(tok, tok + i, &x))
+            return "Cannot read a number";
+         (*tmpl->setd)(tmpl->base, done++, x);
+      }
+      return NULL;
+   }
+   
+   char *line = NULL;
+   size_t maxlen = 0;
+   const char *errmsg = NULL;
+   while (done < size && c != EOF) {
+      size_t len = 0;
+      while ((c = getc(f)) != EOF) {
+         if (len + 1 >= maxlen) {
+            char *l = realloc(line, maxlen = 2 * maxlen + 256);
+            if (! l) {
+               free(line);
+               return "not enough memory";
+            }
+            line = l;
+         }
+         line[len++] = c;
+         if (c == '\n')
+            break;
+      }
+      if (! len)
+         break;
+      line[len] = 0;
+      text_job_t j = *tmpl;
+      j.s = line;
+      j.e = line + len;
+      j.off = done;
+      j.n = tmpl->ncols;
+      text_parse(&j);
+      if (j.err) {
+         errmsg = "Cannot read a number";
+         break;
+      }
+      done += j.n;
+   }
+   free(line);
+   if (!errmsg && done < size)
+      errmsg = "file is too short";
+   return errmsg;
+}
+
+/* Read numbers from a text file, selecting columns when <ncols> is nonzero */
+void import_array_text_columns(index_t *ind, FILE *f, const int *cols, int ncols)
 {
    size_t size, elsize;
-   real x;
    /* validate */
    mode_check(ind, &size, &elsize);
    ifn (index_contiguousp(ind))
       error(NIL, "index not contiguous", NIL);
    storage_type_t type = IND_STTYPE(ind);
-   void (*setd)(gptr,size_t,real) = storage_setd[type];
-
    if (index_emptyp(ind))
       return;
    if (type == ST_AT || type == ST_GPTR )
       error(NIL, "cannot read data for this storage type",IND_ATST(ind));
-   
+   if (ncols && size % ncols)
+      error(NIL, "array size is not a multiple of the number of columns", NIL);
+
+   /* map columns to positions in a row */
+   int maxcol = -1;
+   for (int i = 0; i < ncols; i++) {
+      if (cols[i] < 0)
+         error(NIL, "illegal column number", NEW_NUMBER(cols[i]));
+      maxcol = (cols[i] > maxcol) ? cols[i] : maxcol;
+   }
+   int *colpos = mm_blob((maxcol + 1) * sizeof(int));
+   for (int i = 0; i <= maxcol; i++)
+      colpos[i] = -1;
+   for (int i = 0; i < ncols; i++) {
+      if (colpos[cols[i]] >= 0)
+         error(NIL, "duplicate column number", NEW_NUMBER(cols[i]));
+      colpos[cols[i]] = i;
+   }
+
+   text_job_t tmpl;
+   memset(&tmpl, 0, sizeof(tmpl));
+   tmpl.colpos = colpos;
+   tmpl.ncols = ncols;
+   tmpl.maxcol = maxcol;
+   tmpl.setd = storage_setd[type];
+   tmpl.base = IND_BASE(ind);
+
    /* load */
-   char *p = IND_BASE(ind);
-   begin_idx_aloop1(ind, off) {
-      if (fscanf(f, " %lf ", &x) != 1) {
-         error(NIL,"Cannot read a number",NIL);
-      }
-      (*setd)(p, off, x);
-   } end_idx_aloop1(ind, off);
+   const char *errmsg;
+   struct stat sb;
+   if (!fstat(fileno(f), &sb) && S_ISREG(sb.st_mode))
+      errmsg = import_text_blocks(&tmpl, f, size);
+   else
+      errmsg = import_text_stream(&tmpl, f, size);
+   if (errmsg)
+      error(NIL, errmsg, NIL);
+
+   /* leave <f> at the next non blank character */
+   int c;
+   while ((c = getc(f)) != EOF && isspace(c))
+      ;
+   if (c != EOF)
+      ungetc(c, f);
+}
+
+void import_array_text(index_t *ind, FILE *f)
+{
+   import_array_text_columns(ind, f, NULL, 0);
 }
 
 
 DX(ximport_arrayOtext)
 {
-   ARG_NUMBER(2);
+   int *cols = NULL, ncols = 0;
+   if (arg_number == 3) {
+      at *l = ALIST(3);
+      ncols = length(l);
+      cols = mm_blob(ncols * sizeof(int) + 1);
+      for (int i = 0; i < ncols; i++, l = Cdr(l)) {
+         ifn (NUMBERP(Car(l)))
+            error(NIL, "not a list of column numbers", APOINTER(3));
+         cols[i] = (int)Number(Car(l));
+      }
+   } else
+      ARG_NUMBER(2);
    at *p;
    if (ISSTRING(2)) {
       FILE *f = open_read(ASTRING(2), NULL); // raises
-      import_array_text(AINDEX(1),f);
+      import_array_text_columns(AINDEX(1), f, cols, ncols);
       file_close(f);
    } else {
       p = APOINTER(2);
       ifn (p && RFILEP(p))
          error(NIL, "not a string or read descriptor", p);
-      import_array_text(AINDEX(1),Mptr(p));
+      import_array_text_columns(AINDEX(1), Mptr(p), cols, ncols);
    }
    return APOINTER(1);
 }
@@ -3685,6 +4866,13 @@ void init_index(void)
    dx_define("array-take", xarray_take);
    dx_define("array-put", xarray_put);
    dx_define("array-where-nonzero", xarray_where_nonzero);
+   dx_define("array-sort!", xarray_sort);
+   dx_define("array-sort-down!", xarray_sort_down);
+   dx_define("array-sum-along", xarray_sum_along);
+   dx_define("array-mean-along", xarray_mean_along);
+   dx_define("array-var-along", xarray_var_along);
+   dx_define("array-sup-along", xarray_sup_along);
+   dx_define("array-inf-along", xarray_inf_along);
    dx_define("array-range", xarray_range);
    dx_define("array-range*", xarray_rangeS);
 
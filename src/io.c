@@ -409,19 +409,26 @@ static void make_testchar_map(const char *s, char *buf)
 
 
 /*
- * skip_char(s) skips any char matched by the string s returns the next char
- * available
+ * fast_input() tells whether the current input comes from a plain file,
+ * that is, neither from a string, nor from the console, nor copied to a
+ * script file. The stdio buffer can then be scanned directly.
  */
-char skip_char(const char *s)
+static bool fast_input(void)
 {
-   char map[256];
-   
-   make_testchar_map(s, map);
-   map[255] = false;
-   map['\r'] |= map['\n'];
+   return (context->input_file && !context->input_string &&
+           !(context->input_file==stdin && prompt_string) &&
+           !error_doc.script_file);
+}
+
 
+/*
+ * skip_map(map) skips any char c such that map[c] is set returns the next
+ * char available
+ */
+static char skip_map(const char *map)
+{
    int c;
-   if (context->input_string || (context->input_file==stdin && prompt_string)) {
+   if (! fast_input()) {
       /* Standard implementation */
       while (map[(unsigned char)(c = next_char())])
          read_char();
@@ -430,42 +437,54 @@ char skip_char(const char *s)
       /* Go as fast as we can */
       c = EOF;
       errno = 0;
-      if (context->input_file) {
-         flockfile(context->input_file);
-         c = getc_unlocked(context->input_file);
-         while (map[(unsigned char)c]) {
-            if (isprint(toascii((unsigned char)c)))
+      flockfile(context->input_file);
+      c = getc_unlocked(context->input_file);
+      while (map[(unsigned char)c]) {
+         if (isprint(toascii((unsigned char)c)))
+            context->input_tab++;
+         else
+            switch (c) {
+            case '\n':
+            case '\r':
+               context->input_tab = 0;
+               break;
+            case '\t':
+               context->input_tab |= 0x7;
                context->input_tab++;
-            else
-               switch (c) {
-               case '\n':
-               case '\r':
-                  context->input_tab = 0;
-                  break;
-               case '\t':
-                  context->input_tab |= 0x7;
-                  context->input_tab++;
-                  break;
-               }
-            c = getc_unlocked(context->input_file);
-         }
-         funlockfile(context->input_file);
-
-         if (ferror(context->input_file)) {
+               break;
+            }
+         c = getc_unlocked(context->input_file);
+      }
+      funlockfile(context->input_file);
+      
+      if (ferror(context->input_file)) {
 #ifdef EINTR
-            if (errno == EINTR)
-               clearerr(context->input_file);
-            else
+         if (errno == EINTR)
+            clearerr(context->input_file);
+         else
 #endif
-               test_file_error(context->input_file, errno);
-         }
-         if (c != EOF)
-            ungetc(c, context->input_file);
+            test_file_error(context->input_file, errno);
       }
+      if (c != EOF)
+         ungetc(c, context->input_file);
    }
    return c;
 }
 
+/*
+ * skip_char(s) skips any char matched by the string s returns the next char
+ * available
+ */
+char skip_char(const char *s)
+{
+   char map[256];
+   
+   make_testchar_map(s, map);
+   map[255] = false;
+   map['\r'] |= map['\n'];
+   return skip_map(map);
+}
+
 DX(xskip_char)
 {
    const char *s;
@@ -536,21 +555,65 @@ DX(xread_string)
 /* 
  * Skip chars until reaching some expression 
  */
+static char space_map[256];
+static char comment_map[256];
+
 char skip_to_expr(void)
 {
    for(;;) {
       char c = next_char();
       if (c == ';') {		/* COMMENT */
-         skip_char("~\n\r\377");
+         skip_map(comment_map);
       } else if (isascii((unsigned char)c) 
                  && isspace((unsigned char)c) ) { 
-         read_char();
+         if (skip_map(space_map) == (char)EOF)
+            context->input_tab = 0;  /* simulated newline */
       } else
          return c;
    }
    return 0;
 }
 
+/*
+ * scan_word(s,e,quote) is the fast path of read_word for plain files.
+ * It copies into s the longest run of characters that read_word would
+ * accept without further ado, stopping before reaching e. Argument quote
+ * is the closing quote for strings, or zero for symbols. Returns the
+ * new end of s. Read_word then continues with the general code.
+ */
+static char *scan_word(char *s, char *e, int quote)
+{
+   if (! fast_input())
+      return s;
+   FILE *f = context->input_file;
+   int lower = !quote && !context->input_case_sensitive;
+   int c = EOF;
+   flockfile(f);
+   while (s < e) {
+      c = getc_unlocked(f);
+      if (quote) {
+         /* printable or high chars but quotes and backslashes */
+         if (c<0x20 || c==0x7f || c==0xff || c==quote || c=='\\')
+            break;
+         if (isprint(toascii(c)))
+            context->input_tab++;
+      } else {
+         /* printable chars that are not special */
+         if (c<=0x20 || c>=0x7f || (get_char_map(c) & CHAR_INTERWORD))
+            break;
+         if (lower)
+            c = tolower(c);
+         context->input_tab++;
+      }
+      *s++ = c;
+      c = EOF;
+   }
+   if (c != EOF)
+      ungetc(c, f);
+   funlockfile(f);
+   return s;
+}
+
 /*
  * read_word reads a lisp word. if the word was a quoted symbol, returns |xxx
  * if it was a string, returns "xxx" if anything else, return it
@@ -572,6 +635,7 @@ static char *read_word(void)
 
    } else if (c == '\"' /*"*/) {   
       *s++ = read_char();
+      s = scan_word(s, string_buffer + STRING_BUFFER - 2, '\"');
       until((c = read_char())=='\"' || c==(char)EOF) {  
          if (isascii(c) && iscntrl(c))
             goto errw1;
@@ -600,6 +664,7 @@ static char *read_word(void)
       *s++ = read_char();
 
    } else {
+      s = scan_word(s, string_buffer + STRING_BUFFER - 2, 0);
       until((c = next_char(), (get_char_map(c) & CHAR_INTERWORD) ||
              (isascii((unsigned char)c) && isspace((unsigned char)c)) ||
 	   (c == (char) EOF))) {
@@ -1372,6 +1437,11 @@ void init_io(void)
          set_char_map(i, CHAR_SHORT_CARET);
    
    set_char_map(0x9f, CHAR_BINARY);
+
+   for (int i=0; i<256; i++)
+      space_map[i] = isascii(i) && isspace(i);
+   make_testchar_map("~\n\r\377", comment_map);
+   comment_map[255] = false;
    
    dx_define("macrochp", xmacrochp);
    dx_define("flush",xflush);
@@ -65,8 +65,7 @@
 
 static sigjmp_buf rejmpbuf;
 static const char *pat;
-static const char *dat, *datstart;
-static unsigned short *buf, *bufstart;
+static const char *dat;
 
 #define RE_LIT      0x0000
 #define RE_RNG      0x1000
@@ -134,7 +133,7 @@ static void regex_single(bounds *ans, bounds buf, int *rnum)
       
    case '\\':
       if (!*pat) serror(3);
-      concatc((*ans),*pat,buf);
+      concatc((*ans),(unsigned char)*pat,buf);
       pat++;
       break;
     
@@ -286,107 +285,444 @@ static void regex_alternate(bounds *ans, bounds buf, int *rnum)
    }
 }
 
-#define MIN_EXECBUF 2000
+/* ----------- nfa simulation ------------ */
 
-static int regex_execute(const char **regsptr, int *regslen, int nregs)
+/*
+ * The compiled program describes a nondeterministic automaton:
+ * RE_FAIL forks a lower priority alternative and RE_JMP loops.
+ * Instead of backtracking over these alternatives, all live
+ * threads are advanced in lockstep over the data (Pike's method).
+ * Threads are kept in priority order and each program location
+ * holds at most one thread per data position. This returns the
+ * leftmost-first matches a backtracking interpreter would return,
+ * in time proportional to the data length.
+ *
+ * Each thread carries a capture vector of 1+3*nregs pointers:
+ * the match start, the register starts, the tentative register
+ * starts (set by RE_START), and the register ends.
+ */
+
+typedef struct nfa_list {
+   int n;
+   int *pc;
+   const char **cap;
+} nfa_list_t;
+
+typedef struct nfa {
+   unsigned short *prog;    /* program, without length word */
+   int len;                 /* program length */
+   int maxregs;             /* registers accounted for in scratch */
+   int nregs;               /* registers tracked in this run */
+   int ncap;                /* capture vector size for this run */
+   const char *datstart;
+   unsigned int gen;        /* current generation */
+   unsigned int *mark;      /* generation of last visit per location */
+   nfa_list_t list[2];
+   const char **icap;       /* capture vector of starting threads */
+   const char **mcap;       /* capture vector of the best match */
+   const char *mend;        /* end of the best match */
+} nfa_t;
+
+#define NFA_SIZE(len,maxregs) \
+   ( (2*(len)+2)*(1+3*(maxregs))*sizeof(char*) + \
+     (len)*(sizeof(unsigned int) + 2*sizeof(int)) )
+
+static void nfa_init(nfa_t *m, unsigned short *buffer, int maxregs, void *scratch)
+{
+   char *p = scratch;
+   int ncap = 1 + 3*maxregs;
+   m->prog = buffer + 1;
+   m->len = buffer[0];
+   m->maxregs = maxregs;
+   m->nregs = 0;
+   m->ncap = 1;
+   m->datstart = 0;
+   m->gen = 0;
+   m->list[0].cap = (const char **)p;     p += m->len*ncap*sizeof(char*);
+   m->list[1].cap = (const char **)p;     p += m->len*ncap*sizeof(char*);
+   m->icap = (const char **)p;            p += ncap*sizeof(char*);
+   m->mcap = (const char **)p;            p += ncap*sizeof(char*);
+   m->list[0].pc = (int *)p;              p += m->len*sizeof(int);
+   m->list[1].pc = (int *)p;              p += m->len*sizeof(int);
+   m->mark = (unsigned int *)p;
+   memset(m->mark, 0, m->len*sizeof(unsigned int));
+}
+
+static void nfa_newgen(nfa_t *m)
 {
-   unsigned short *bfail_buf[MIN_EXECBUF], **bfail = bfail_buf;
-   const char     *dfail_buf[MIN_EXECBUF], **dfail = dfail_buf;
-
-   int sp = 0;
-   int spmax = MIN_EXECBUF;
-   unsigned short  c;
-   while ((c = *buf++)) {
-#ifdef DEBUG_REGEX
-      printf("%04x (%02x)\n",(int)(c)&0xffff,(dat?*dat:0)); 
-#endif
+   if (! ++m->gen) {
+      memset(m->mark, 0, m->len*sizeof(unsigned int));
+      m->gen = 1;
+   }
+}
+
+/* add a thread at location pc and follow its non consuming instructions */
+static void nfa_add(nfa_t *m, nfa_list_t *l, int pc, const char **cap, const char *dat)
+{
+   for (;;) {
+      if (m->mark[pc] == m->gen)
+         return;
+      m->mark[pc] = m->gen;
+      unsigned short c = m->prog[pc];
       switch (c&0xf000) {
 
-      fail:
-         if (--sp < 0)
-            return 0;
-         buf = bfail[sp];
-         dat = dfail[sp];
-         break;
-         
       case RE_CARET:
-         if (dat != datstart)
-            goto fail;
+         if (dat != m->datstart)
+            return;
+         pc += 1;
          break;
 
       case RE_DOLLAR:
          if (*dat)
-            goto fail;
-         break;
-
-      case RE_LIT:
-         if (!*dat)
-            goto fail;
-         if (*dat++ != (char)(c&0x00ff))
-            goto fail;
-         break;
-         
-      case RE_RNG:
-         if (!*dat)
-            goto fail;
-         c -= RE_RNG;
-         if (*dat>=c*16)
-            goto fail;
-         if (!charset_tst( buf, *dat))
-            goto fail;
-         buf += c;
-         dat++;
-         break;
-
-      case RE_ANY:
-         if (!*dat)
-            goto fail;
-         dat++;
+            return;
+         pc += 1;
          break;
 
       case RE_JMP&0xf000:
          if ((*dat==0) && (c<RE_JMP)) /* never jump backwards if end of data */
-            break;
-         buf = buf + c - RE_JMP;
+            pc += 1;
+         else
+            pc += 1 + c - RE_JMP;
          break;
-      
+
       case RE_FAIL&0xf000:
-         if (sp >= spmax) { /* enlarge stack */
-            spmax += spmax;
-            unsigned short **bfail2 = mm_blob(sizeof(short *)*spmax);
-            char **dfail2 = mm_blob(sizeof(char *)*spmax);
-            if (!bfail2 || !dfail2)
-               error(NIL,"out of memory",NIL);
-            memcpy(bfail2, bfail, sizeof(short *)*spmax/2);
-            memcpy(dfail2, dfail, sizeof(short *)*spmax/2);
-            bfail = bfail2;
-            dfail = (const char **)dfail2;
-         }
-         dfail[sp] = dat;
-         bfail[sp] = buf + c - RE_FAIL;
-         sp += 1;
+         nfa_add(m, l, pc+1, cap, dat);
+         pc += 1 + c - RE_FAIL;
          break;
- 
+
       case RE_START:
          c &= 0x00ff;
-         if (c < nregs)
-            regsptr[nregs+c] = dat;
+         if (c < m->nregs) {
+            const char **r = cap + 1 + m->nregs + c;
+            const char *old = *r;
+            *r = dat;
+            nfa_add(m, l, pc+1, cap, dat);
+            *r = old;
+            return;
+         }
+         pc += 1;
          break;
 
       case RE_END:
          c &= 0x00ff;
-         if (c >= nregs)
+         if (c < m->nregs) {
+            const char **r = cap + 1 + c;
+            const char *oldbeg = r[0];
+            const char *oldend = r[2*m->nregs];
+            r[0] = r[m->nregs];
+            r[2*m->nregs] = dat;
+            nfa_add(m, l, pc+1, cap, dat);
+            r[0] = oldbeg;
+            r[2*m->nregs] = oldend;
+            return;
+         }
+         pc += 1;
+         break;
+
+      default: /* RE_LIT, RE_RNG, RE_ANY and final zero */
+         l->pc[l->n] = pc;
+         memcpy(l->cap + l->n*m->ncap, cap, m->ncap*sizeof(char*));
+         l->n += 1;
+         return;
+      }
+   }
+}
+
+/* match at dat, or at the first possible position after dat when seek is set */
+static int nfa_run(nfa_t *m, const char *datstart, const char *dat, int nregs, int seek)
+{
+   nfa_list_t *cl = &m->list[0];
+   nfa_list_t *nl = &m->list[1];
+   int matched = 0;
+
+   if (nregs > m->maxregs)
+      nregs = m->maxregs;
+   m->nregs = nregs;
+   m->ncap = 1 + 3*nregs;
+   m->datstart = datstart;
+   for (int i=0; i<m->ncap; i++)
+      m->icap[i] = 0;
+   
+   nfa_newgen(m);
+   cl->n = 0;
+   m->icap[0] = dat;
+   nfa_add(m, cl, 0, m->icap, dat);
+   while (cl->n > 0) {
+      nfa_newgen(m);
+      nl->n = 0;
+      for (int i=0; i<cl->n; i++) {
+         int pc = cl->pc[i];
+         const char **cap = cl->cap + i*m->ncap;
+         unsigned short c = m->prog[pc];
+         switch (c&0xf000) {
+
+         case RE_LIT:
+            if (!c) {
+               /* success: lower priority threads are discarded */
+               memcpy(m->mcap, cap, m->ncap*sizeof(char*));
+               m->mend = dat;
+               matched = 1;
+               goto cut;
+            }
+            if (*dat && *dat == (char)(c&0x00ff))
+               nfa_add(m, nl, pc+1, cap, dat+1);
+            break;
+
+         case RE_RNG: {
+            unsigned char d = *dat;
+            c -= RE_RNG;
+            if (d && d<c*16 && charset_tst(m->prog+pc+1, d))
+               nfa_add(m, nl, pc+1+c, cap, dat+1);
             break;
-         regsptr[c] = regsptr[nregs+c];
-         regslen[c] = dat-regsptr[c];
+         }
+
+         case RE_ANY:
+            if (*dat)
+               nfa_add(m, nl, pc+1, cap, dat+1);
+            break;
+         }
+      }
+   cut:
+      if (!*dat)
          break;
+      dat += 1;
+      if (seek && !matched && *dat) {
+         m->icap[0] = dat;
+         nfa_add(m, nl, 0, m->icap, dat);
+      }
+      nfa_list_t *tmp = cl;
+      cl = nl;
+      nl = tmp;
+   }
+   return matched;
+}
+
+static void nfa_regs(nfa_t *m, const char **regptr, int *reglen, int nregs)
+{
+   for (int c=0; c<2*nregs; c++)
+      regptr[c] = 0;
+   for (int c=0; c<nregs; c++) {
+      reglen[c] = 0;
+      if (c < m->nregs && m->mcap[1+c]) {
+         regptr[c] = m->mcap[1+c];
+         reglen[c] = m->mcap[1+2*m->nregs+c] - regptr[c];
       }
    }
-   buf--;
-   return 1;
 }
 
 
+/* ----------- lazy dfa ------------ */
+
+/*
+ * When neither registers nor match boundaries are needed, the
+ * priority of threads is irrelevant and the set of live program
+ * locations is all that matters. Such sets are the states of a
+ * deterministic automaton whose transitions are computed on
+ * demand and remembered across calls. A state is identified by
+ * the sorted locations reached after consuming a character, the
+ * non consuming instructions being followed when leaving it.
+ */
+
+#define DFA_MAX_STATES 64
+
+typedef struct dfa_state {
+   int n;                   /* number of locations */
+   int *pc;                 /* sorted locations */
+   short atstart;           /* state for the start of data */
+   short accept;            /* final zero reachable before end of data */
+   short acceptend;         /* final zero reachable at end (-1 if unknown) */
+   short next[256];         /* transitions (-1 if unknown) */
+} dfa_state_t;
+
+typedef struct dfa {
+   int nstates;
+   dfa_state_t *states[DFA_MAX_STATES];
+   int *tmp;                /* scratch locations */
+} dfa_t;
+
+static const char dfa_probe[] = "x";
+
+/* follow non consuming instructions from the locations of state s */
+static nfa_list_t *dfa_closure(nfa_t *m, dfa_state_t *s, int atend)
+{
+   const char *dat = (atend) ? dfa_probe+1 : dfa_probe;
+   nfa_list_t *l = &m->list[0];
+   m->nregs = 0;
+   m->ncap = 1;
+   m->datstart = (s->atstart) ? dat : 0;
+   m->icap[0] = 0;
+   nfa_newgen(m);
+   l->n = 0;
+   for (int i=0; i<s->n; i++)
+      nfa_add(m, l, s->pc[i], m->icap, dat);
+   return l;
+}
+
+static int dfa_accepts(nfa_t *m, dfa_state_t *s, int atend)
+{
+   nfa_list_t *l = dfa_closure(m, s, atend);
+   for (int i=0; i<l->n; i++)
+      if (!m->prog[l->pc[i]])
+         return 1;
+   return 0;
+}
+
+static int dfa_compare(const void *a, const void *b)
+{
+   return *(const int *)a - *(const int *)b;
+}
+
+/* return index of state with given locations, or -1 if full */
+static int dfa_state(nfa_t *m, dfa_t *d, int atstart, int *pc, int n)
+{
+   for (int i=0; i<d->nstates; i++) {
+      dfa_state_t *s = d->states[i];
+      if (s->atstart==atstart && s->n==n && !memcmp(s->pc, pc, n*sizeof(int)))
+         return i;
+   }
+   if (d->nstates >= DFA_MAX_STATES)
+      return -1;
+   dfa_state_t *s = malloc(sizeof(dfa_state_t) + n*sizeof(int));
+   if (!s)
+      error(NIL, "out of memory", NIL);
+   s->n = n;
+   s->pc = (int *)(s+1);
+   memcpy(s->pc, pc, n*sizeof(int));
+   s->atstart = atstart;
+   s->acceptend = -1;
+   for (int c=0; c<256; c++)
+      s->next[c] = -1;
+   s->accept = dfa_accepts(m, s, 0);
+   d->states[d->nstates] = s;
+   return d->nstates++;
+}
+
+static int dfa_transition(nfa_t *m, dfa_t *d, int si, unsigned char d0)
+{
+   dfa_state_t *s = d->states[si];
+   nfa_list_t *l = dfa_closure(m, s, 0);
+   int n = 0;
+   for (int i=0; i<l->n; i++) {
+      int pc = l->pc[i];
+      unsigned short c = m->prog[pc];
+      switch (c&0xf000) {
+      case RE_LIT:
+         if (c && d0 == (c&0x00ff))
+            d->tmp[n++] = pc+1;
+         break;
+      case RE_RNG:
+         c -= RE_RNG;
+         if (d0<c*16 && charset_tst(m->prog+pc+1, d0))
+            d->tmp[n++] = pc+1+c;
+         break;
+      case RE_ANY:
+         d->tmp[n++] = pc+1;
+         break;
+      }
+   }
+   qsort(d->tmp, n, sizeof(int), dfa_compare);
+   int k = 0;
+   for (int i=0; i<n; i++)
+      if (!k || d->tmp[k-1] != d->tmp[i])
+         d->tmp[k++] = d->tmp[i];
+   int ti = dfa_state(m, d, 0, d->tmp, k);
+   if (ti >= 0)
+      d->states[si]->next[d0] = ti;
+   return ti;
+}
+
+/* returns 1 or 0 if the string matches or not, -1 if the dfa is full */
+static int dfa_match(nfa_t *m, dfa_t *d, const char *dat)
+{
+   int start = 0;
+   int si = dfa_state(m, d, 1, &start, 1);
+   if (si < 0)
+      return -1;
+   for (; *dat; dat++) {
+      dfa_state_t *s = d->states[si];
+      if (s->accept)
+         return 1;
+      if (!s->n)
+         return 0;
+      int ti = s->next[(unsigned char)*dat];
+      if (ti < 0 && (ti = dfa_transition(m, d, si, *dat)) < 0)
+         return -1;
+      si = ti;
+   }
+   dfa_state_t *s = d->states[si];
+   if (s->acceptend < 0)
+      s->acceptend = dfa_accepts(m, s, 1);
+   return s->acceptend;
+}
+
+
+/* ----------- compiled pattern cache ------------ */
+
+/*
+ * Compiled patterns are remembered in a small direct mapped
+ * cache keyed by pattern string and strictness, together with
+ * the scratch memory of the nfa and the states of the dfa.
+ */
+
+#define REGEX_CACHE_SIZE 64
+
+typedef struct regex_entry {
+   char *pattern;
+   int strict;
+   int regnum;
+   unsigned short *buffer;
+   nfa_t nfa;
+   dfa_t dfa;
+} regex_entry_t;
+
+static regex_entry_t *regex_cache[REGEX_CACHE_SIZE];
+
+static void regex_entry_free(regex_entry_t *e)
+{
+   for (int i=0; i<e->dfa.nstates; i++)
+      free(e->dfa.states[i]);
+   free(e);
+}
+
+static regex_entry_t *regex_lookup(at *p, int strict)
+{
+   const char *pattern = String(p);
+   unsigned long h = strict;
+   for (const char *s=pattern; *s; s++)
+      h = h*31 + (unsigned char)*s;
+   regex_entry_t **where = &regex_cache[h % REGEX_CACHE_SIZE];
+   regex_entry_t *e = *where;
+   if (e && e->strict==strict && !strcmp(e->pattern, pattern))
+      return e;
+
+   unsigned short buffer[1024];
+   int regnum = 0;
+   const char *msg = regex_compile(pattern,buffer,buffer+1024,strict,&regnum);
+   if (msg)
+      error(NIL,msg,p);
+   int len = buffer[0];
+   size_t size = sizeof(regex_entry_t) + NFA_SIZE(len, regnum) + 
+      len*sizeof(int) + len*sizeof(short) + strlen(pattern) + 1;
+   regex_entry_t *ne = malloc(size);
+   if (!ne)
+      error(NIL, "out of memory", NIL);
+   char *q = (char *)(ne+1);
+   char *scratch = q;                      q += NFA_SIZE(len, regnum);
+   ne->dfa.nstates = 0;
+   ne->dfa.tmp = (int *)q;                 q += len*sizeof(int);
+   ne->buffer = (unsigned short *)q;       q += len*sizeof(short);
+   memcpy(ne->buffer, buffer, len*sizeof(short));
+   nfa_init(&ne->nfa, ne->buffer, regnum, scratch);
+   ne->pattern = q;
+   strcpy(ne->pattern, pattern);
+   ne->strict = strict;
+   ne->regnum = regnum;
+   if (e)
+      regex_entry_free(e);
+   *where = ne;
+   return ne;
+}
+
 
 /* ----------- public routines ------------ */
 
@@ -426,35 +762,29 @@ const char *regex_compile(const char *pattern,
 int regex_exec(unsigned short *buffer, const char *string, 
                const char **regptr, int *reglen, int nregs)
 {
-   for(int c=0;c<2*nregs;c++)
-      regptr[c] = 0;
-   for(int c=0;c<nregs;c++)
-      reglen[c] = 0;
-   dat = datstart = string;
-   buf = bufstart = (unsigned short*)(buffer+1);
-   return regex_execute(regptr,reglen,nregs);
+   nfa_t m;
+   nfa_init(&m, buffer, nregs, mm_blob(NFA_SIZE(buffer[0], nregs)));
+   int ok = nfa_run(&m, string, string, nregs, 0);
+   if (nregs)
+      nfa_regs(&m, regptr, reglen, nregs);
+   return ok;
 }
 
 
 int regex_seek(unsigned short *buffer, const char *string, const char *seekstart, 
                const char **regptr, int *reglen, int nregs, const char **start, const char **end)
 {
-   datstart = string;
-   while (*seekstart) {
-      for(int c=0;c<2*nregs;c++)
-         regptr[c] = 0;
-      for (int c=0;c<nregs;c++)
-         reglen[c] = 0;
-      dat = seekstart;
-      buf = bufstart = (unsigned short*)(buffer+1);
-      if (regex_execute(regptr, reglen, nregs)) {
-         *start = seekstart;
-         *end = dat;
-         return 1;
-      }
-      seekstart++;
-   }
-   return 0;
+   if (!*seekstart)
+      return 0;
+   nfa_t m;
+   nfa_init(&m, buffer, nregs, mm_blob(NFA_SIZE(buffer[0], nregs)));
+   if (!nfa_run(&m, string, seekstart, nregs, 1))
+      return 0;
+   if (nregs)
+      nfa_regs(&m, regptr, reglen, nregs);
+   *start = m.mcap[0];
+   *end = m.mend;
+   return 1;
 }
 
 
@@ -480,47 +810,40 @@ int regex_seek(unsigned short *buffer, const char *string, const char *seekstart
 
 DX(xregex_match)
 {
-   unsigned short buffer[1024];
-
    ARG_NUMBER(2);
-   const char *pat = ASTRING(1);
+   ASTRING(1);
    const char *dat = ASTRING(2);
+   regex_entry_t *e = regex_lookup(APOINTER(1), 1);
 
-   pat = regex_compile(pat,buffer,buffer+1024,1,NULL);
-   if (pat)
-      error(NIL,pat,APOINTER(1));
-
-   if (regex_exec(buffer,dat,NULL,NULL,0))
-      return t();  
-   else
-      return NIL;
+   int ok = dfa_match(&e->nfa, &e->dfa, dat);
+   if (ok < 0)
+      ok = nfa_run(&e->nfa, dat, dat, 0, 0);
+   return (ok) ? t() : NIL;
 }
 
 
 DX(xregex_extract)
 {
-   unsigned short buffer[1024];
    at *ans=NIL;
    at **where = &ans;
-   int regnum = 0;
    int i;
 
    ARG_NUMBER(2);
-   const char *pat = ASTRING(1);
+   ASTRING(1);
    const char *dat = ASTRING(2);
-   pat = regex_compile(pat,buffer,buffer+1024,1,&regnum);
-   if (pat)
-      error(NIL,pat,APOINTER(1));
-
-   const char **regptr = mm_blob(2*regnum*sizeof(char*));
-   int *reglen = mm_blob(regnum*sizeof(int));
-   if (regnum && (!regptr || !reglen))
-      error(NIL, "out of memory", NIL);
-   
-   if (regex_exec(buffer,dat,regptr,reglen,regnum)) {
+   regex_entry_t *e = regex_lookup(APOINTER(1), 1);
+   int regnum = e->regnum;
+
+   if (nfa_run(&e->nfa, dat, dat, regnum, 0)) {
+      const char **regptr = mm_blob(2*regnum*sizeof(char*));
+      int *reglen = mm_blob(regnum*sizeof(int));
+      if (regnum && (!regptr || !reglen))
+         error(NIL, "out of memory", NIL);
+      nfa_regs(&e->nfa, regptr, reglen, regnum);
       for (i=0; i<regnum; i++) {
          char *s = mm_blob(reglen[i]+1);
-         strncpy(s, regptr[i], reglen[i]);
+         if (reglen[i])
+            strncpy(s, regptr[i], reglen[i]);
          s[reglen[i]] = '\0';
          *where = new_cons(NEW_STRING(s), NIL);
          where = &Cdr(*where);
@@ -535,7 +858,6 @@ DX(xregex_extract)
 DX(xregex_seek)
 {
    int n;
-   unsigned short buffer[1024];
 
    if (arg_number==3)
       n = AINTEGER(3);
@@ -543,20 +865,17 @@ DX(xregex_seek)
       n = 0;
       ARG_NUMBER(2);
    }
+   ASTRING(1);
    const char *datstart;
-   const char *pat = ASTRING(1);
    const char *dat = datstart = ASTRING(2);
    while (--n>=0 && *dat)
       dat++;
 
-   pat = regex_compile(pat,buffer,buffer+1024,0,NULL);
-   if (pat)
-      error(NIL,pat,APOINTER(1));
-  
-   const char *start,*end;
-   if (regex_seek(buffer,datstart,dat,NULL,NULL,0,&start,&end)) {
-      dat = ASTRING(2);
-      return new_cons(NEW_NUMBER(start-dat),
+   regex_entry_t *e = regex_lookup(APOINTER(1), 0);
+   if (*dat && nfa_run(&e->nfa, datstart, dat, 0, 1)) {
+      const char *start = e->nfa.mcap[0];
+      const char *end = e->nfa.mend;
+      return new_cons(NEW_NUMBER(start-datstart),
                       new_cons(NEW_NUMBER(end-start),
                                NIL ) );
    }
@@ -568,16 +887,12 @@ DX(xregex_seek)
 DX(xregex_subst)
 {
    ARG_NUMBER(3);
+   ASTRING(1);
    const char *datstart;
-   const char *pat = ASTRING(1);
    const char *str = ASTRING(2);
    const char *dat = datstart = ASTRING(3);
- 
-   int regnum = 0;
-   unsigned short buffer[1024];
-   pat = regex_compile(pat,buffer,buffer+1024,0,&regnum);
-   if (pat)
-      error(NIL,pat,APOINTER(1));
+   regex_entry_t *e = regex_lookup(APOINTER(1), 0);
+   int regnum = e->regnum;
   
    struct large_string ls;
    large_string_init(&ls);
@@ -585,7 +900,11 @@ DX(xregex_subst)
       int reglen[10];
       const char *regptr[20];
       const char *start, *end, *s1;
-      if (!regex_seek(buffer,datstart,dat,regptr,reglen,10,&start,&end))
+      if (*dat && nfa_run(&e->nfa, datstart, dat, 10, 1)) {
+         nfa_regs(&e->nfa, regptr, reglen, 10);
+         start = e->nfa.mcap[0];
+         end = e->nfa.mend;
+      } else
          start = end = dat + strlen(dat);
       if (end <= dat)
          start = end = dat + 1;
@@ -609,6 +609,107 @@ DX(xnew_storage_mmap)
    return new_storage_mmap(t, Gptr(atf), offset, readonly)->backptr;
 }
 
+/* new storage in memory shared with forked processes */
+storage_t *new_storage_shared(storage_type_t t, size_t n)
+{
+   if (t==ST_MPTR || t==ST_GPTR || t==ST_AT)
+      RAISEF("cannot share a pointer storage", NIL);
+   storage_t *st = mm_allocv(mt_storage, sizeof(storage_t));
+   size_t len = (n ? n : 1) * storage_sizeof[t];
+#ifdef UNIX
+# if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#  define MAP_ANONYMOUS MAP_ANON
+# endif
+   errno = 0;
+   gptr addr = mmap(0,len,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_ANONYMOUS,-1,0);
+   if (addr == (void*)-1L)
+      test_file_error(NULL, errno);
+#else
+   RAISEF("shared storages are not supported on this system", NIL);
+   gptr addr = NULL;
+#endif
+   st->type = t;
+   st->kind = STS_MMAP;
+   st->isreadonly = false;
+   st->mmap_len = len;
+   st->mmap_addr = addr;
+   st->size = n;
+   st->data = addr;
+   st->backptr = new_at(storage_class[st->type], st);
+   add_notifier(st, (wr_notify_func_t *)storage_notify, NULL);
+   return st;
+}
+
+DX(xnew_storage_shared)
+{
+   ARG_NUMBER(2);
+   storage_type_t t = dht_from_cname(ASYMBOL(1));
+   ifn (t < ST_LAST)
+      RAISEF("not a storage class", APOINTER(1));
+   int n = AINTEGER(2);
+   if (n < 0)
+      RAISEF("invalid size", APOINTER(2));
+   return new_storage_shared(t, n)->backptr;
+}
+
+/* ordinary storages are allocated without the mmap fields,
+ * so the mapping travels with the notifier instead */
+typedef struct {
+   gptr   addr;
+   size_t len;
+} shared_map_t;
+
+static void storage_unshare_notify(storage_t *st, void *arg)
+{
+   shared_map_t *map = arg;
+#ifdef UNIX
+   munmap(map->addr, map->len);
+#endif
+   free(map);
+   st->data = NULL;
+}
+
+/* move the contents of storage st into memory shared with 
+ * forked processes; indices on st remain valid */
+void storage_share(storage_t *st)
+{
+   if (st->kind == STS_MMAP)
+      return;
+   if (st->type==ST_MPTR || st->type==ST_GPTR || st->type==ST_AT)
+      RAISEF("cannot share a pointer storage", st->backptr);
+   if (st->kind != STS_MANAGED)
+      RAISEF("storage is not allocated by lush", st->backptr);
+   size_t len = (st->size ? st->size : 1) * storage_sizeof[st->type];
+   shared_map_t *map = malloc(sizeof(shared_map_t));
+   ifn (map)
+      RAISEF("not enough memory", NIL);
+#ifdef UNIX
+   errno = 0;
+   gptr addr = mmap(0,len,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_ANONYMOUS,-1,0);
+   if (addr == (void*)-1L) {
+      free(map);
+      test_file_error(NULL, errno);
+   }
+#else
+   free(map);
+   RAISEF("shared storages are not supported on this system", NIL);
+   gptr addr = NULL;
+#endif
+   memcpy(addr, st->data, st->size * storage_sizeof[st->type]);
+   st->kind = STS_MMAP;
+   st->data = addr;
+   map->addr = addr;
+   map->len = len;
+   add_notifier(st, (wr_notify_func_t *)storage_unshare_notify, map);
+}
+
+DX(xstorage_share)
+{
+   ARG_NUMBER(1);
+   storage_share(ASTORAGE(1));
+   return NIL;
+}
+
 #endif // HAVE_MMAP
 
 /* ------------ ALLOCATION: MALLOC ------------ */
@@ -661,6 +762,9 @@ void storage_realloc(storage_t *st, size_t size, at *init)
 {
    if (size < st->size)
       RAISEF("storage size cannot be reduced", st->backptr);
+   /* a copy would no longer see the mapped file or the other processes */
+   if (st->kind == STS_MMAP)
+      RAISEF("cannot reallocate a memory mapped storage", st->backptr);
    
    size_t s = size*storage_sizeof[st->type];
    size_t olds = st->size*storage_sizeof[st->type];
@@ -969,6 +1073,8 @@ void init_storage()
    dx_define("new-storage/foreign", xnew_storage_foreign);
 #ifdef HAVE_MMAP
    dx_define("new-storage/mmap",xnew_storage_mmap);
+   dx_define("new-storage/shared",xnew_storage_shared);
+   dx_define("storage-share",xstorage_share);
 #endif
    dx_define("storage-alloc",xstorage_alloc);
    dx_define("storage-realloc",xstorage_realloc);
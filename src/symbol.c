@@ -80,6 +80,10 @@ typedef struct hash_name {
 /* hash table of currently used symbol names */
 static hash_name_t **live_names = NULL;
 static hash_name_t **purgatory = NULL;
+static int nbuckets = 0;         /* grows as symbols are created */
+static int nlive = 0;            /* number of names in live_names */
+
+#define BUCKET(h)  ((h) % (nbuckets-1))
 
 /* cache for bindings */
 static symbol_t **cache = NULL;
@@ -93,6 +97,7 @@ static at *at_scope;
 static bool unlink_symbol_hash(hash_name_t *);
 static hash_name_t *resurrect_or_new_symbol_hash(const char *, unsigned long);
 static hash_name_t *get_symbol_hash_by_name(const char *);
+static void grow_symbol_hash(void);
 
 
 static void clear_symbol_hash(hash_name_t *hn, size_t _)
@@ -176,8 +181,8 @@ static mt_t mt_at_symbol = mt_undefined;
  */
 static bool unlink_symbol_hash(hash_name_t *hn)
 {
-   hash_name_t **lasthn = live_names + (hn->hash % (HASHTABLESIZE-1));
-   hash_name_t **lastpurg = purgatory + (hn->hash % (HASHTABLESIZE-1));
+   hash_name_t **lasthn = live_names + BUCKET(hn->hash);
+   hash_name_t **lastpurg = purgatory + BUCKET(hn->hash);
    hash_name_t *lhn = *lasthn;
 
    while (lhn && (lhn != hn)) {
@@ -190,6 +195,7 @@ static bool unlink_symbol_hash(hash_name_t *hn)
       *lasthn = lhn->next;
       lhn->next = *lastpurg;
       *lastpurg = lhn;
+      nlive--;
       return false;
 
    } else {
@@ -236,7 +242,7 @@ static hash_name_t *get_symbol_hash_by_name(const char *s)
    }
    
    /* Search in live_names */
-   hash_name_t **lasthn = live_names + (hash % (HASHTABLESIZE-1));
+   hash_name_t **lasthn = live_names + BUCKET(hash);
    hash_name_t *hn = *lasthn;
    while (hn && strcmp(s, hn->name)) {
       lasthn = &(hn->next);
@@ -248,8 +254,12 @@ static hash_name_t *get_symbol_hash_by_name(const char *s)
 
 static hash_name_t *resurrect_or_new_symbol_hash(const char *s, unsigned long hash)
 {
+   /* keep the chains short when many symbols are created */
+   if (nlive > 2*nbuckets)
+      grow_symbol_hash();
+
    /* check purgatory, create new if not found there */  
-   hash_name_t **lastpurg = purgatory + (hash % (HASHTABLESIZE-1));
+   hash_name_t **lastpurg = purgatory + BUCKET(hash);
    hash_name_t *hn = *lastpurg;
    while (hn && strcmp(s, hn->name)) {
       lastpurg = &(hn->next);
@@ -273,12 +283,43 @@ static hash_name_t *resurrect_or_new_symbol_hash(const char *s, unsigned long ha
    }
 
    /* link in at front of bucket */
-   hash_name_t **lasthn = live_names + (hash % (HASHTABLESIZE-1));
+   hash_name_t **lasthn = live_names + BUCKET(hash);
    hn->next = *lasthn;
    *lasthn = hn;
+   nlive++;
    return hn;
 }
 
+/* allocate bucket arrays for live_names and purgatory */
+static void alloc_symbol_hash(int n)
+{
+   live_names = mm_allocv(mt_refs, 2 * n * sizeof(hash_name_t *));
+   purgatory = &(live_names[n]);
+   nbuckets = n;
+}
+
+/* double the number of buckets and rehash all names */
+static void grow_symbol_hash(void)
+{
+   hash_name_t **old = live_names;
+   int n = nbuckets;
+   MM_ENTER;
+   MM_ANCHOR(old);
+   alloc_symbol_hash(2*n);
+   for (int i = 0; i < 2*n; i++) {
+      hash_name_t **table = i<n ? live_names : purgatory;
+      hash_name_t *hn = old[i];
+      while (hn) {
+         hash_name_t *next = hn->next;
+         hn->next = table[BUCKET(hn->hash)];
+         table[BUCKET(hn->hash)] = hn;
+         hn = next;
+      }
+      old[i] = NULL;
+   }
+   MM_EXIT;
+}
+
 
 /* push the value q on the symbol stack */
 
@@ -327,7 +368,7 @@ char *symbol_generator(const char *text, int state)
       hn = 0;
    }
    
-   while (hni < HASHTABLESIZE) {
+   while (hni < nbuckets) {
       /* move to next */
       if (!hn)  {
          hn = live_names[hni];
@@ -442,7 +483,7 @@ DX(xnameof)
 
 
 #define iter_hash_name(i,hn) \
-  for (i=live_names; i<live_names+HASHTABLESIZE; i++) \
+  for (i=live_names; i<live_names+nbuckets; i++) \
   for (hn= *i; hn; hn = hn->next)
 
 /* sorted list of globally defined symbols */
@@ -861,12 +902,10 @@ void pre_init_symbol(void)
                                 clear_at_symbol, mark_at_symbol, finalize_at_symbol);
    
    if (!live_names) {
-      size_t s = sizeof(hash_name_t *) * HASHTABLESIZE + \
-         sizeof(void *) * (SYMBOL_CACHE_SIZE + 1);
-      live_names = mm_allocv(mt_refs, 2*s);
-      purgatory = &(live_names[HASHTABLESIZE]);
-      cache = (void *) (&live_names[2*HASHTABLESIZE]);
+      alloc_symbol_hash(HASHTABLESIZE);
       MM_ROOT(live_names);
+      cache = mm_allocv(mt_refs, sizeof(void *) * (SYMBOL_CACHE_SIZE + 1));
+      MM_ROOT(cache);
    }
 
    if (!symbol_class) {
@@ -64,6 +64,9 @@
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
 #endif
+#if HAVE_PTHREAD
+# include <pthread.h>
+#endif
 #ifdef TIME_WITH_SYS_TIME
 # include <sys/time.h>
 # include <time.h>
@@ -95,6 +98,9 @@
 #ifdef HAVE_SYS_SELECT_H
 # include <sys/select.h>
 #endif
+#ifdef HAVE_SYS_EPOLL_H
+# include <sys/epoll.h>
+#endif
 #ifdef HAVE_SYS_TTOLD_H
 # include <sys/ttold.h>
 #endif
@@ -819,6 +825,180 @@ int os_wait(int nfds, int* fds, bool console, unsigned long ms)
 }
 
 
+/* os_fd_closed --
+ * Tells whether fd no longer refers to an open file.
+ */
+bool os_fd_closed(int fd)
+{
+   return fcntl(fd, F_GETFD) < 0 && errno == EBADF;
+}
+
+/* os_file_pending --
+ * Tells whether stdio has input buffered in file f.
+ */
+bool os_file_pending(FILE *f)
+{
+#if defined(__GLIBC__)
+   return f->_IO_read_ptr < f->_IO_read_end;
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)
+   return f->_r > 0;
+#else
+   return false;
+#endif
+}
+
+/* os_watch_fd --
+ * Starts watching file descriptor fd for readability (mode 1)
+ * or writability (mode 2), or stops watching it (mode 0).
+ * Returns a file descriptor that becomes readable whenever
+ * a watched descriptor is ready, or -1 if the watched
+ * descriptors must be polled with os_poll_fds.
+ */
+
+#ifdef HAVE_SYS_EPOLL_H
+
+static int watch_epfd = -1;
+
+/* epoll refuses regular files, which select reports as
+   always ready: such descriptors are kept in this list. */
+static int *ready_fds = 0, *ready_modes = 0;
+static int nready = 0, maxready = 0;
+
+static bool ready_del(int fd)
+{
+   for (int i=0; i<nready; i++)
+      if (ready_fds[i] == fd) {
+         nready--;
+         ready_fds[i] = ready_fds[nready];
+         ready_modes[i] = ready_modes[nready];
+         return true;
+      }
+   return false;
+}
+
+static void ready_add(int fd, int mode)
+{
+   ready_del(fd);
+   if (nready >= maxready) {
+      int n = (maxready) ? 2*maxready : 16;
+      int *f = realloc(ready_fds, n*sizeof(int));
+      if (f)
+         ready_fds = f;
+      int *m = realloc(ready_modes, n*sizeof(int));
+      if (m)
+         ready_modes = m;
+      if (!f || !m)
+         RAISEF("not enough memory", NIL);
+      maxready = n;
+   }
+   ready_fds[nready] = fd;
+   ready_modes[nready++] = mode;
+}
+
+int os_watch_fd(int fd, int mode)
+{
+   if (watch_epfd < 0) {
+      watch_epfd = epoll_create(16);
+      if (watch_epfd < 0)
+         RAISEF(strerror(errno), NIL);
+      fcntl(watch_epfd, F_SETFD, FD_CLOEXEC);
+   }
+   struct epoll_event ev;
+   memset(&ev, 0, sizeof(ev));
+   ev.events = (mode == 2) ? EPOLLOUT : EPOLLIN;
+   ev.data.fd = fd;
+   if (!mode) {
+      if (!ready_del(fd) && 
+          epoll_ctl(watch_epfd, EPOLL_CTL_DEL, fd, &ev) < 0 &&
+          errno != ENOENT && errno != EBADF)
+         RAISEF(strerror(errno), NIL);
+   } else if (epoll_ctl(watch_epfd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+      if (errno == EPERM)
+         ready_add(fd, mode);
+      else if (errno != EEXIST || epoll_ctl(watch_epfd, EPOLL_CTL_MOD, fd, &ev) < 0)
+         RAISEF(strerror(errno), NIL);
+   }
+   return watch_epfd;
+}
+
+/* os_poll_fds --
+ * Stores at most maxfds ready watched descriptors
+ * into array fds without waiting, and their mode
+ * into array modes. Returns their number.
+ */
+int os_poll_fds(int *fds, int *modes, int maxfds)
+{
+   struct epoll_event ev[64];
+   if (watch_epfd < 0)
+      return 0;
+   if (maxfds > 64)
+      maxfds = 64;
+   int k = 0;
+   for (; k<nready && k<maxfds; k++) {
+      fds[k] = ready_fds[k];
+      modes[k] = ready_modes[k];
+   }
+   if (k == maxfds)
+      return k;
+   int n = epoll_wait(watch_epfd, ev, maxfds - k, 0);
+   for (int i=0; i<n; i++) {
+      fds[k+i] = ev[i].data.fd;
+      modes[k+i] = (ev[i].events & EPOLLOUT) ? 2 : 1;
+   }
+   return (n > 0) ? k + n : k;
+}
+
+#else
+
+static fd_set watch_rset, watch_wset;
+static int watch_maxfd = -1;
+
+int os_watch_fd(int fd, int mode)
+{
+   if (fd < 0 || fd >= FD_SETSIZE)
+      RAISEF("file descriptor out of range", NEW_NUMBER(fd));
+   FD_CLR(fd, &watch_rset);
+   FD_CLR(fd, &watch_wset);
+   if (mode == 1)
+      FD_SET(fd, &watch_rset);
+   else if (mode == 2)
+      FD_SET(fd, &watch_wset);
+   if (mode && fd > watch_maxfd)
+      watch_maxfd = fd;
+   return -1;
+}
+
+int os_poll_fds(int *fds, int *modes, int maxfds)
+{
+   if (watch_maxfd < 0)
+      return 0;
+   fd_set rset = watch_rset;
+   fd_set wset = watch_wset;
+   struct timeval tv;
+   tv.tv_sec = 0;
+   tv.tv_usec = 0;
+   int r = select(watch_maxfd+1, &rset, &wset, 0, &tv);
+   if (r < 0 && errno == EBADF) {
+      /* forget descriptors closed while watched */
+      for (int fd=0; fd<=watch_maxfd; fd++)
+         if (os_fd_closed(fd))
+            os_watch_fd(fd, 0);
+      return 0;
+   }
+   if (r <= 0)
+      return 0;
+   int n = 0;
+   for (int fd=0; fd<=watch_maxfd && n<maxfds; fd++)
+      if (FD_ISSET(fd, &rset) || FD_ISSET(fd, &wset)) {
+         fds[n] = fd;
+         modes[n++] = FD_ISSET(fd, &wset) ? 2 : 1;
+      }
+   return n;
+}
+
+#endif
+
+
 /* console_getline -- 
    gets a line on the console (and process events) */
 
@@ -1283,6 +1463,344 @@ DY(ybground)
 
 
 
+/* ---------------------------------------- */
+/* SAMPLING PROFILER */
+/* ---------------------------------------- */
+
+/*
+ * The SIGPROF handler walks the interpreter call chain (top_link)
+ * and, when running compiled code, the compiled trace stack
+ * (dh_trace_root).  It then formats the stack as a folded line
+ * "outer;...;inner" and counts it in an open hash table.
+ * The handler is the only writer.  Readers block SIGPROF while
+ * they scan the table, so no other locking is necessary.
+ */
+
+#if defined(SIGPROF) && defined(ITIMER_PROF)
+
+#define PROF_DEPTH  256
+#define PROF_LINE   4096
+#define PROF_SLOTS  16384
+#define PROF_ARENA  (4<<20)
+
+typedef struct prof_slot {
+   unsigned long hash;
+   int offset;
+   int count;
+} prof_slot_t;
+
+static prof_slot_t *prof_table = NULL;
+static char *prof_arena = NULL;
+static int prof_arena_used;
+static int prof_nslots;
+static long prof_samples;
+static long prof_dropped;
+#if HAVE_PTHREAD
+static pthread_t prof_thread;  /* the interpreter thread */
+#endif
+
+static int prof_append(char *line, int n, const char *name)
+{
+   if (n > 0 && n < PROF_LINE - 1)
+      line[n++] = ';';
+   for (; *name && n < PROF_LINE - 1; name++)
+      line[n++] = (*name==';' || *name==' ' || *name=='\n') ? '_' : *name;
+   return n;
+}
+
+static const char *prof_frame_name(at *call)
+{
+   at *head = CONSP(call) ? Car(call) : call;
+   if (SYMBOLP(head)) {
+      const char *name = nameof(Symbol(head));
+      return name ? name : "?";
+   } else if (CONSP(head))
+      return "(lambda)";
+   return "?";
+}
+
+static void prof_irq(void)
+{
+   static struct call_chain *links[PROF_DEPTH];
+   static const char *traces[PROF_DEPTH];
+   static char line[PROF_LINE];
+   int save = errno;
+
+#if HAVE_PTHREAD
+   /* worker threads block SIGPROF, but foreign threads may not */
+   if (! pthread_equal(pthread_self(), prof_thread))
+      return;
+#endif
+
+   /* collect frames, innermost first */
+   int nlinks = 0;
+   bool truncated = false;
+   for (struct call_chain *l = top_link; l; l = l->prev) {
+      if (nlinks == PROF_DEPTH) {
+         truncated = true;
+         break;
+      }
+      links[nlinks++] = l;
+   }
+   int ntraces = 0;
+   if (in_compiled_code)
+      for (struct dh_trace_stack *st = dh_trace_root; 
+           st && ntraces < PROF_DEPTH; st = st->next)
+         traces[ntraces++] = st->info;
+
+   /* format folded stack, outermost first */
+   int n = 0;
+   if (truncated)
+      n = prof_append(line, n, "[truncated]");
+   else if (nlinks == 0 && ntraces == 0)
+      n = prof_append(line, n, "[toplevel]");
+   while (nlinks > 0)
+      n = prof_append(line, n, prof_frame_name(links[--nlinks]->this_call));
+   while (ntraces > 0)
+      n = prof_append(line, n, traces[--ntraces]);
+   line[n] = 0;
+
+   /* count it */
+   unsigned long h = 2166136261UL;
+   for (int i = 0; i < n; i++)
+      h = (h ^ (unsigned char)line[i]) * 16777619UL;
+   int i = h & (PROF_SLOTS - 1);
+   prof_samples++;
+   for (;;) {
+      prof_slot_t *slot = &prof_table[i];
+      if (slot->count == 0) {
+         if (prof_nslots >= PROF_SLOTS * 3 / 4 ||
+             prof_arena_used + n + 1 > PROF_ARENA) {
+            prof_dropped++;
+            break;
+         }
+         memcpy(prof_arena + prof_arena_used, line, n + 1);
+         slot->hash = h;
+         slot->offset = prof_arena_used;
+         slot->count = 1;
+         prof_arena_used += n + 1;
+         prof_nslots++;
+         break;
+      } else if (slot->hash == h && !strcmp(prof_arena + slot->offset, line)) {
+         slot->count++;
+         break;
+      }
+      i = (i + 1) & (PROF_SLOTS - 1);
+   }
+   errno = save;
+}
+
+static void prof_set_timer(int hz)
+{
+   struct itimerval delay;
+   delay.it_interval.tv_sec = 0;
+   delay.it_interval.tv_usec = hz ? 1000000 / hz : 0;
+   delay.it_value = delay.it_interval;
+   setitimer(ITIMER_PROF, &delay, NULL);
+}
+
+static void prof_block(int how)
+{
+   sigset_t sset;
+   sigemptyset(&sset);
+   sigaddset(&sset, SIGPROF);
+   sigprocmask(how, &sset, NULL);
+}
+
+DX(xsampling_profiler_start)
+{
+   int hz = 100;
+   if (arg_number) {
+      ARG_NUMBER(1);
+      hz = AINTEGER(1);
+   }
+   if (hz < 1 || hz > 10000)
+      RAISEFX("frequency out of range", APOINTER(1));
+
+   prof_set_timer(0);
+   if (! prof_table) {
+      prof_table = malloc(PROF_SLOTS * sizeof(prof_slot_t));
+      prof_arena = malloc(PROF_ARENA);
+      ifn (prof_table && prof_arena)
+         RAISEFX("not enough memory", NIL);
+   }
+   memset(prof_table, 0, PROF_SLOTS * sizeof(prof_slot_t));
+   prof_arena_used = 0;
+   prof_nslots = 0;
+   prof_samples = 0;
+   prof_dropped = 0;
+#if HAVE_PTHREAD
+   prof_thread = pthread_self();
+#endif
+
+   struct sigaction sact;
+   sact.sa_handler = (SIGHANDLERTYPE)prof_irq;
+   sact.sa_flags = SA_RESTART;
+   sigemptyset(&sact.sa_mask);
+   if (sigaction(SIGPROF, &sact, NULL) < 0)
+      RAISEFX("sigaction failed", NIL);
+   prof_set_timer(hz);
+   return NEW_NUMBER(hz);
+}
+
+DX(xsampling_profiler_stop)
+{
+   ARG_NUMBER(0);
+   prof_set_timer(0);
+   return NEW_NUMBER(prof_samples);
+}
+
+DX(xsampling_profiler_dump)
+{
+   ARG_NUMBER(0);
+   if (! prof_table)
+      return NIL;
+   /* copy the table while the handler is blocked */
+   prof_block(SIG_BLOCK);
+   int nslots = prof_nslots;
+   prof_slot_t *slots = malloc((nslots + 1) * sizeof(prof_slot_t));
+   char *arena = malloc(prof_arena_used + 1);
+   if (slots && arena) {
+      memcpy(arena, prof_arena, prof_arena_used);
+      for (int i = 0, j = 0; i < PROF_SLOTS; i++)
+         if (prof_table[i].count)
+            slots[j++] = prof_table[i];
+   }
+   long dropped = prof_dropped;
+   prof_block(SIG_UNBLOCK);
+   ifn (slots && arena) {
+      free(slots);
+      free(arena);
+      RAISEFX("not enough memory", NIL);
+   }
+   char count[32];
+   for (int i = 0; i < nslots; i++) {
+      print_string(arena + slots[i].offset);
+      sprintf(count, " %d\n", slots[i].count);
+      print_string(count);
+   }
+   if (dropped) {
+      sprintf(count, "[dropped] %ld\n", dropped);
+      print_string(count);
+   }
+   free(slots);
+   free(arena);
+   return NEW_NUMBER(nslots);
+}
+
+#endif /* SIGPROF && ITIMER_PROF */
+
+
+/* ---------------------------------------- */
+/* TILED WORK */
+/* ---------------------------------------- */
+
+/* run_tiles -- calls f(arg, lo, hi) on consecutive tiles covering
+ * [0,n). Tiles hold at least <grain> items and are handed out to the
+ * threads through an atomic counter, so that uneven tiles balance.
+ * Function f must not call the interpreter.
+ */
+
+#define TILE_THREADS  16        /* maximal number of threads */
+#define TILE_SPLIT    4         /* tiles per thread */
+
+static int tile_threads = 0;    /* 0 means one per processor */
+
+#if HAVE_PTHREAD
+/* start_worker -- like pthread_create, but asynchronous signals are
+ * blocked in the new thread. Their handlers (interrupts, timers, the
+ * sampling profiler) touch interpreter state and must only run in
+ * the interpreter thread.
+ */
+int start_worker(pthread_t *t, void *(*f)(void *), void *arg)
+{
+   sigset_t sset, old;
+   sigfillset(&sset);
+   sigdelset(&sset, SIGSEGV);
+   sigdelset(&sset, SIGBUS);
+   sigdelset(&sset, SIGFPE);
+   sigdelset(&sset, SIGILL);
+   pthread_sigmask(SIG_BLOCK, &sset, &old);
+   int err = pthread_create(t, NULL, f, arg);
+   pthread_sigmask(SIG_SETMASK, &old, NULL);
+   return err;
+}
+#endif
+
+typedef struct {
+   void (*f)(void *, ptrdiff_t, ptrdiff_t);
+   void *arg;
+   ptrdiff_t n, size, next;
+} tile_job_t;
+
+static void *tile_worker(void *arg)
+{
+   tile_job_t *job = arg;
+   for (;;) {
+      ptrdiff_t lo = __sync_fetch_and_add(&job->next, job->size);
+      if (lo >= job->n)
+         break;
+      ptrdiff_t hi = lo + job->size;
+      (*job->f)(job->arg, lo, (hi < job->n) ? hi : job->n);
+   }
+   return NULL;
+}
+
+void run_tiles(void (*f)(void *, ptrdiff_t, ptrdiff_t), void *arg,
+               ptrdiff_t n, ptrdiff_t grain)
+{
+   if (n <= 0)
+      return;
+   if (grain < 1)
+      grain = 1;
+   int nt = tile_threads;
+   if (nt <= 0) {
+      nt = 1;
+#ifdef _SC_NPROCESSORS_ONLN
+      nt = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+   }
+   if (nt > n / grain)
+      nt = n / grain;
+   if (nt > TILE_THREADS)
+      nt = TILE_THREADS;
+#if HAVE_PTHREAD
+   if (nt > 1) {
+      tile_job_t job;
+      job.f = f;
+      job.arg = arg;
+      job.n = n;
+      job.size = (n + nt * TILE_SPLIT - 1) / (nt * TILE_SPLIT);
+      job.size = (job.size < grain) ? grain : job.size;
+      job.next = 0;
+      pthread_t threads[TILE_THREADS];
+      int started[TILE_THREADS];
+      for (int i = 1; i < nt; i++)
+         started[i] = !start_worker(&threads[i], tile_worker, &job);
+      tile_worker(&job);
+      for (int i = 1; i < nt; i++)
+         if (started[i])
+            pthread_join(threads[i], NULL);
+      return;
+   }
+#endif
+   (*f)(arg, 0, n);
+}
+
+DX(xtile_threads)
+{
+   if (arg_number) {
+      ARG_NUMBER(1);
+      int nt = AINTEGER(1);
+      if (nt < 0)
+         RAISEFX("number of threads must be nonnegative", APOINTER(1));
+      tile_threads = nt;
+   }
+   return NEW_NUMBER(tile_threads);
+}
+
+
+
 /* ---------------------------------------- */
 /* ENVIRONMENT */
 /* ---------------------------------------- */
@@ -1701,6 +2219,97 @@ DX(xfilteropenpty)
    return new_cons(f2, new_cons(f1, new_cons(NEW_NUMBER(pid), NULL)));
 }
 
+/* forkopen -- forks a lush process talking through pipes */
+
+DY(yforkopen)
+{
+   ifn (CONSP(ARG_LIST))
+      RAISEFX("syntax error", NIL);
+
+   int fd_up[2], fd_dn[2];
+   errno = 0;
+   if (pipe(fd_up) < 0) 
+      test_file_error(NULL, errno);
+   if (pipe(fd_dn) < 0) {
+      errno = 0;
+      close(fd_up[0]);
+      close(fd_up[1]);
+      test_file_error(NULL, errno);
+   }
+   fflush(stdout);
+   fflush(stderr);
+   
+   pid_t pid = fork();
+   if (pid < 0) {
+      errno = 0;
+      close(fd_up[0]);
+      close(fd_up[1]);
+      close(fd_dn[0]);
+      close(fd_dn[1]);
+      test_file_error(NULL, errno);
+   } else if (pid == 0) {
+      /* Child process */
+      close(fd_up[1]);
+      close(fd_dn[0]);
+      FILE *fin = fdopen(fd_up[0], "r");
+      FILE *fout = fdopen(fd_dn[1], "w");
+      if (!fin || !fout)
+         _exit(127);
+      goodsignal(SIGINT, SIG_IGN);
+      if (error_doc.script_file)
+         set_script(NIL);
+      context->input_file = fin;
+      context->input_string = NULL;
+      context->input_tab = 0;
+      context->output_file = fout;
+      context->output_tab = 0;
+      error_doc.debug_toplevel = true;
+      if (sigsetjmp(context->error_jump, 1)) {
+         fflush(fout);
+         _exit(10);
+      }
+      progn(ARG_LIST);
+      fflush(fout);
+      _exit(0);
+   }
+   
+   /* Parent process */ 
+   close(fd_up[0]);
+   close(fd_dn[1]);
+   FILE *str_up, *str_dn;
+   errno = 0;
+   ifn ((str_up = fdopen(fd_up[1], "w")))
+      test_file_error(NULL, errno);
+   errno = 0;
+   ifn ((str_dn = fdopen(fd_dn[0], "r")))
+      test_file_error(NULL, errno);
+   at *f1 = new_rfile(str_dn);
+   at *f2 = new_wfile(str_up);
+   return new_cons(f2, new_cons(f1, new_cons(NEW_NUMBER(pid), NULL)));
+}
+
+DX(xwaitpid)
+{
+   int options = 0;
+   if (arg_number == 2) {
+      if (APOINTER(2))
+         options = WNOHANG;
+   } else
+      ARG_NUMBER(1);
+   pid_t pid = AINTEGER(1);
+   int status;
+   pid_t r;
+   errno = 0;
+   while ((r = waitpid(pid, &status, options)) < 0)
+      if (errno != EINTR)
+         test_file_error(NULL, errno);
+   if (r == 0)
+      return t();
+   if (WIFEXITED(status))
+      return NEW_NUMBER(WEXITSTATUS(status));
+   return NIL;
+}
+
 
 DX(xsocketopen)
 {
@@ -1911,6 +2520,11 @@ void init_unix(void)
    dx_define("isatty", xisatty);
    dx_define("sys", xsys);
    dy_define("bground", ybground);
+#if defined(SIGPROF) && defined(ITIMER_PROF)
+   dx_define("sampling-profiler-start", xsampling_profiler_start);
+   dx_define("sampling-profiler-stop", xsampling_profiler_stop);
+   dx_define("sampling-profiler-dump", xsampling_profiler_dump);
+#endif
    dy_define("realtime", yrealtime);
    dy_define("cputime", ycputime);
    dx_define("time", xtime);
@@ -1919,8 +2533,11 @@ void init_unix(void)
    dx_define("beep", xbeep);
    dx_define("getenv", xgetenv);
    dx_define("getconf", xgetconf);
+   dx_define("tile-threads", xtile_threads);
    dx_define("filteropen", xfilteropen);
    dx_define("filteropenpty", xfilteropenpty);
+   dy_define("forkopen", yforkopen);
+   dx_define("waitpid", xwaitpid);
    dx_define("socketopen", xsocketopen);
    dx_define("socketaccept", xsocketaccept);
    dx_define("socketselect", xsocketselect);